@@ -31,6 +31,10 @@ Notes:
 #undef min
 #undef max
 
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define Z3_CPP_MOVE_SEMANTICS
+#endif
+
 /**
    \defgroup cppapi C++ API
 
@@ -491,6 +495,17 @@ namespace z3 {
         operator Z3_ast() const { return m_ast; }
         operator bool() const { return m_ast != 0; }
         ast & operator=(ast const & s) { Z3_inc_ref(s.ctx(), s.m_ast); if (m_ast) Z3_dec_ref(ctx(), m_ast); m_ctx = s.m_ctx; m_ast = s.m_ast; return *this; }
+#ifdef Z3_CPP_MOVE_SEMANTICS
+        /**
+           \brief Moving transfers the reference without touching the reference count.
+           The source is left empty, as if it had been created with ast(c).
+        */
+        ast(ast && s) noexcept:object(s), m_ast(s.m_ast) { s.m_ast = 0; }
+        ast & operator=(ast && s) noexcept { 
+            if (this != &s) { if (m_ast) Z3_dec_ref(ctx(), m_ast); m_ctx = s.m_ctx; m_ast = s.m_ast; s.m_ast = 0; } 
+            return *this; 
+        }
+#endif
         Z3_ast_kind kind() const { Z3_ast_kind r = Z3_get_ast_kind(ctx(), m_ast); check_error(); return r; }
         unsigned hash() const { unsigned r = Z3_get_ast_hash(ctx(), m_ast); check_error(); return r; }
         friend std::ostream & operator<<(std::ostream & out, ast const & n);
@@ -529,6 +544,10 @@ namespace z3 {
            \brief Return true if this sort and \c s are equal.
         */
         sort & operator=(sort const & s) { return static_cast<sort&>(ast::operator=(s)); }
+#ifdef Z3_CPP_MOVE_SEMANTICS
+        sort(sort && s) noexcept:ast(static_cast<ast&&>(s)) {}
+        sort & operator=(sort && s) noexcept { return static_cast<sort&>(ast::operator=(static_cast<ast&&>(s))); }
+#endif
         /**
            \brief Return the internal sort kind.
         */
@@ -621,6 +640,10 @@ namespace z3 {
         func_decl(func_decl const & s):ast(s) {}
         operator Z3_func_decl() const { return reinterpret_cast<Z3_func_decl>(m_ast); }
         func_decl & operator=(func_decl const & s) { return static_cast<func_decl&>(ast::operator=(s)); }
+#ifdef Z3_CPP_MOVE_SEMANTICS
+        func_decl(func_decl && s) noexcept:ast(static_cast<ast&&>(s)) {}
+        func_decl & operator=(func_decl && s) noexcept { return static_cast<func_decl&>(ast::operator=(static_cast<ast&&>(s))); }
+#endif
 
         /**
            \brief retrieve unique identifier for func_decl.
@@ -665,6 +688,10 @@ namespace z3 {
         expr(context & c, Z3_ast n):ast(c, reinterpret_cast<Z3_ast>(n)) {}
         expr(expr const & n):ast(n) {}
         expr & operator=(expr const & n) { return static_cast<expr&>(ast::operator=(n)); }
+#ifdef Z3_CPP_MOVE_SEMANTICS
+        expr(expr && n) noexcept:ast(static_cast<ast&&>(n)) {}
+        expr & operator=(expr && n) noexcept { return static_cast<expr&>(ast::operator=(static_cast<ast&&>(n))); }
+#endif
 
         /**
            \brief Return the sort of this expression.
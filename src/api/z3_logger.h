@@ -21,12 +21,14 @@ Notes:
 struct ll_escaped { char const * m_str; ll_escaped(char const * str):m_str(str) {} };
 static std::ostream & operator<<(std::ostream & out, ll_escaped const & d);
 
-static void __declspec(noinline) R()  { *g_z3_log << "R\n"; g_z3_log->flush(); }
-static void __declspec(noinline) P(void * obj)  { *g_z3_log << "P " << obj << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) I(int64_t i)   { *g_z3_log << "I " << i << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) U(uint64_t u)   { *g_z3_log << "U " << u << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) D(double d)   { *g_z3_log << "D " << d << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) S(Z3_string str) { *g_z3_log << "S \"" << ll_escaped(str) << "\"\n"; g_z3_log->flush(); }
+// Argument records are buffered and the stream is flushed once per call record (C),
+// so a crash inside an API function still leaves the complete call in the log.
+static void __declspec(noinline) R()  { *g_z3_log << "R\n"; }
+static void __declspec(noinline) P(void * obj)  { *g_z3_log << "P " << obj << "\n"; }
+static void __declspec(noinline) I(int64_t i)   { *g_z3_log << "I " << i << "\n"; }
+static void __declspec(noinline) U(uint64_t u)   { *g_z3_log << "U " << u << "\n"; }
+static void __declspec(noinline) D(double d)   { *g_z3_log << "D " << d << "\n"; }
+static void __declspec(noinline) S(Z3_string str) { *g_z3_log << "S \"" << ll_escaped(str) << "\"\n"; }
 static void __declspec(noinline) Sy(Z3_symbol sym) { 
     symbol s = symbol::mk_symbol_from_c_ptr(reinterpret_cast<void *>(sym));
     if (s == symbol::null) {
@@ -38,12 +40,11 @@ static void __declspec(noinline) Sy(Z3_symbol sym) {
     else {
         *g_z3_log << "$ |" << ll_escaped(s.bare_str()) << "|\n";
     }
-    g_z3_log->flush();
 }
-static void __declspec(noinline) Ap(unsigned sz) { *g_z3_log << "p " << sz << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) Au(unsigned sz) { *g_z3_log << "u " << sz << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) Ai(unsigned sz) { *g_z3_log << "i " << sz << "\n"; g_z3_log->flush(); }
-static void __declspec(noinline) Asy(unsigned sz) { *g_z3_log << "s " << sz << "\n"; g_z3_log->flush(); }
+static void __declspec(noinline) Ap(unsigned sz) { *g_z3_log << "p " << sz << "\n"; }
+static void __declspec(noinline) Au(unsigned sz) { *g_z3_log << "u " << sz << "\n"; }
+static void __declspec(noinline) Ai(unsigned sz) { *g_z3_log << "i " << sz << "\n"; }
+static void __declspec(noinline) Asy(unsigned sz) { *g_z3_log << "s " << sz << "\n"; }
 static void __declspec(noinline) C(unsigned id)   { *g_z3_log << "C " << id << "\n"; g_z3_log->flush(); }
 void __declspec(noinline) _Z3_append_log(char const * msg) { *g_z3_log << "M \"" << ll_escaped(msg) << "\"\n"; g_z3_log->flush(); }
 
@@ -31,19 +31,22 @@ struct blaster_cfg {
     bv_util &       m_util;
     blaster_cfg(bool_rewriter & r, bv_util & u):m_rewriter(r), m_util(u) {}
 
+    // see bit_blaster_cfg::sort_pair
+    static void sort_pair(expr * & a, expr * & b) { if (a->get_id() > b->get_id()) std::swap(a, b); }
+
     ast_manager & m() const { return m_util.get_manager(); }
     numeral power(unsigned n) const { return rational::power_of_two(n); }
-    void mk_xor(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_xor(a, b, r); }
+    void mk_xor(expr * a, expr * b, expr_ref & r) { sort_pair(a, b); m_rewriter.mk_xor(a, b, r); }
     void mk_xor3(expr * a, expr * b, expr * c, expr_ref & r) {
         expr_ref tmp(m());
         mk_xor(b, c, tmp);
         mk_xor(a, tmp, r);
     }
-    void mk_iff(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_iff(a, b, r); }
-    void mk_and(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_and(a, b, r); }
+    void mk_iff(expr * a, expr * b, expr_ref & r) { sort_pair(a, b); m_rewriter.mk_iff(a, b, r); }
+    void mk_and(expr * a, expr * b, expr_ref & r) { sort_pair(a, b); m_rewriter.mk_and(a, b, r); }
     void mk_and(expr * a, expr * b, expr * c, expr_ref & r) { m_rewriter.mk_and(a, b, c, r); }
     void mk_and(unsigned sz, expr * const * args, expr_ref & r) { m_rewriter.mk_and(sz, args, r); }
-    void mk_or(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_or(a, b, r); }
+    void mk_or(expr * a, expr * b, expr_ref & r) { sort_pair(a, b); m_rewriter.mk_or(a, b, r); }
     void mk_or(expr * a, expr * b, expr * c, expr_ref & r) { m_rewriter.mk_or(a, b, c, r); }
     void mk_or(unsigned sz, expr * const * args, expr_ref & r) { m_rewriter.mk_or(sz, args, r); }
     void mk_not(expr * a, expr_ref & r) { m_rewriter.mk_not(a, r); }
@@ -62,8 +65,8 @@ struct blaster_cfg {
 #endif
     }
     void mk_ite(expr * c, expr * t, expr * e, expr_ref & r) { m_rewriter.mk_ite(c, t, e, r); }
-    void mk_nand(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_nand(a, b, r); }
-    void mk_nor(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_nor(a, b, r); }
+    void mk_nand(expr * a, expr * b, expr_ref & r) { sort_pair(a, b); m_rewriter.mk_nand(a, b, r); }
+    void mk_nor(expr * a, expr * b, expr_ref & r) { sort_pair(a, b); m_rewriter.mk_nor(a, b, r); }
 };
 
 class blaster : public bit_blaster_tpl<blaster_cfg> {
@@ -629,6 +629,7 @@ class get_info_cmd : public cmd {
     symbol   m_reason_unknown;
     symbol   m_all_statistics;
     symbol   m_assertion_stack_levels;
+    symbol   m_memory;
 public:
     get_info_cmd():
         cmd("get-info"),
@@ -639,7 +640,8 @@ public:
         m_status(":status"),
         m_reason_unknown(":reason-unknown"),
         m_all_statistics(":all-statistics"),
-        m_assertion_stack_levels(":assertion-stack-levels") {
+        m_assertion_stack_levels(":assertion-stack-levels"),
+        m_memory(":memory") {
     }
     char const * get_usage() const override { return "<keyword>"; }
     char const * get_descr(cmd_context & ctx) const override { return "get information."; }
@@ -677,6 +679,14 @@ public:
         else if (opt == m_assertion_stack_levels) {
             ctx.regular_stream() << "(:assertion-stack-levels " << ctx.num_scopes() << ")" << std::endl;
         }
+        else if (opt == m_memory) {
+            statistics st;
+            get_memory_statistics(st);
+            if (ctx.has_manager())
+                st.update("num asts", ctx.m().get_num_asts());
+            st.update("num assertions", ctx.assertions().size());
+            st.display_smt2(ctx.regular_stream());
+        }
         else {
             ctx.print_unsupported(opt, m_line, m_pos);
         }
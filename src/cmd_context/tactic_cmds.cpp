@@ -27,6 +27,7 @@ Notes:
 #include "ast/ast_smt2_pp.h"
 #include "tactic/tactic.h"
 #include "tactic/tactical.h"
+#include "tactic/tactic_params.hpp"
 #include "tactic/probe.h"
 #include "solver/check_sat_result.h"
 #include "cmd_context/cmd_context_to_goal.h"
@@ -656,8 +657,12 @@ static tactic * mk_skip_if_failed(cmd_context & ctx, sexpr * n) {
 tactic * sexpr2tactic(cmd_context & ctx, sexpr * n) {
     if (n->is_symbol()) {
         tactic_cmd * cmd = ctx.find_tactic_cmd(n->get_symbol());
-        if (cmd != nullptr)
-            return cmd->mk(ctx.m());
+        if (cmd != nullptr) {
+            tactic * t = cmd->mk(ctx.m());
+            if (tactic_params().profile())
+                t = profile_tactic(n->get_symbol().bare_str(), t);
+            return t;
+        }
         sexpr * decl = ctx.find_user_tactic(n->get_symbol());
         if (decl != nullptr)
             return sexpr2tactic(ctx, decl);
@@ -20,6 +20,7 @@ Revision History:
 #include "ast/ast_pp.h"
 #include "ast/ast_smt2_pp.h"
 #include "ast/ast_util.h"
+#include "ast/arith_decl_plugin.h"
 #include "model/func_interp.h"
 
 func_entry::func_entry(ast_manager & m, unsigned arity, expr * const * args, expr * result):
@@ -69,15 +70,82 @@ void func_entry::deallocate(ast_manager & m, unsigned arity) {
     allocator.deallocate(sz, this);
 }
 
+/**
+   \brief Index from argument tuples to entries.
+   Arguments are compared by pointer. ast_manager::are_equal also identifies distinct
+   irrational algebraic numbers with the same value, so lookups with such arguments
+   use the linear scan in func_interp::get_entry.
+*/
+struct func_interp::entry_index {
+    struct key {
+        expr * const * m_args;
+        func_entry *   m_entry;
+    };
+
+    struct key_hash_proc {
+        unsigned m_arity;
+        key_hash_proc(unsigned arity): m_arity(arity) {}
+        unsigned operator()(key const & k) const {
+            unsigned h = m_arity;
+            for (unsigned i = 0; i < m_arity; i++)
+                h = combine_hash(h, k.m_args[i]->get_id());
+            return h;
+        }
+    };
+
+    struct key_eq_proc {
+        unsigned m_arity;
+        key_eq_proc(unsigned arity): m_arity(arity) {}
+        bool operator()(key const & k1, key const & k2) const {
+            for (unsigned i = 0; i < m_arity; i++)
+                if (k1.m_args[i] != k2.m_args[i])
+                    return false;
+            return true;
+        }
+    };
+
+    static const unsigned threshold = 16;
+
+    unsigned                                    m_arity;
+    family_id                                   m_arith_fid;
+    hashtable<key, key_hash_proc, key_eq_proc>  m_table;
+
+    entry_index(ast_manager & m, unsigned arity):
+        m_arity(arity),
+        m_arith_fid(m.mk_family_id("arith")),
+        m_table(DEFAULT_HASHTABLE_INITIAL_CAPACITY, key_hash_proc(arity), key_eq_proc(arity)) {
+    }
+
+    void insert(func_entry * e) {
+        key k = { e->get_args(), e };
+        // keep the first entry, as the linear scan does.
+        m_table.insert_if_not_there(k);
+    }
+
+    bool can_find(expr * const * args) const {
+        for (unsigned i = 0; i < m_arity; i++)
+            if (is_app_of(args[i], m_arith_fid, OP_IRRATIONAL_ALGEBRAIC_NUM))
+                return false;
+        return true;
+    }
+
+    func_entry * find(expr * const * args) const {
+        key k = { args, nullptr }, r;
+        return m_table.find(k, r) ? r.m_entry : nullptr;
+    }
+};
+
 func_interp::func_interp(ast_manager & m, unsigned arity):
     m_manager(m),
     m_arity(arity),
     m_else(nullptr),
     m_args_are_values(true),
-    m_interp(nullptr) {
+    m_interp(nullptr),
+    m_index(nullptr) {
 }
 
 func_interp::~func_interp() {
+    reset_index();
     for (func_entry* curr : m_entries) {
         curr->deallocate(m_manager, m_arity);
     }
@@ -100,6 +168,11 @@ void func_interp::reset_interp_cache() {
     m_interp = nullptr;
 }
 
+void func_interp::reset_index() {
+    dealloc(m_index);
+    m_index = nullptr;
+}
+
 bool func_interp::is_fi_entry_expr(expr * e, ptr_vector<expr> & args) {
     args.reset();
     expr* c, *t, *f, *a0, *a1;
@@ -171,6 +244,13 @@ bool func_interp::is_constant() const {
    args_are_values to true if for all entries e e.args_are_values() is true.
 */
 func_entry * func_interp::get_entry(expr * const * args) const {
+    if (!m_index && m_entries.size() >= entry_index::threshold) {
+        m_index = alloc(entry_index, m_manager, m_arity);
+        for (func_entry* curr : m_entries) 
+            m_index->insert(curr);
+    }
+    if (m_index && m_index->can_find(args)) 
+        return m_index->find(args);
     for (func_entry* curr : m_entries) {
         if (curr->eq_args(m(), m_arity, args))
             return curr;
@@ -208,6 +288,8 @@ void func_interp::insert_new_entry(expr * const * args, expr * r) {
     if (!new_entry->args_are_values())
         m_args_are_values = false;
     m_entries.push_back(new_entry);
+    if (m_index)
+        m_index->insert(new_entry);
 }
 
 bool func_interp::eval_else(expr * const * args, expr_ref & result) const {
@@ -264,6 +346,7 @@ void func_interp::compress() {
     }
     if (j < m_entries.size()) {
         reset_interp_cache();
+        reset_index();
         m_entries.shrink(j);
     }
     // other compression, if else is a default branch.
@@ -275,6 +358,7 @@ void func_interp::compress() {
         }
         m_entries.reset();
         reset_interp_cache();
+        reset_index();
         m_manager.inc_ref(new_else);
         m_manager.dec_ref(m_else);
         m_else = new_else;
@@ -285,6 +369,7 @@ void func_interp::compress() {
         }
         m_entries.reset();
         reset_interp_cache();
+        reset_index();
         expr_ref new_else(m_manager.mk_var(0, m_manager.get_sort(m_else)), m_manager);
         m_manager.inc_ref(new_else);
         m_manager.dec_ref(m_else);
@@ -73,8 +73,13 @@ class func_interp {
 
     expr *                 m_interp; //!< cache for representing the whole interpretation as a single expression (it uses ite terms).
 
+    struct entry_index;
+    mutable entry_index *  m_index; //!< hash index over the arguments of m_entries, built lazily when there are many entries.
+
     void reset_interp_cache();
 
+    void reset_index();
+
     expr * get_interp_core() const;
 
 public:
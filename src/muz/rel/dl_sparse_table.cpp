@@ -1235,6 +1235,9 @@ namespace datalog {
             }
 
 
+            if (to_remove.empty())
+                return; // nothing removed, the indexes are still valid
+
             //the largest offsets are at the end, so we can remove them one by one
             while (!to_remove.empty()) {
                 store_offset removed_ofs = to_remove.back();
@@ -1316,6 +1319,8 @@ namespace datalog {
             sparse_table& t = get(_t);
             svector<store_offset> to_remove;
             collect_to_remove(t, get(_s1), get(_s2), to_remove);
+            if (to_remove.empty())
+                return;
             for (unsigned i = 0; i < to_remove.size(); ++i) {
                 t.m_data.remove_offset(to_remove[i]);
             }
@@ -209,8 +209,22 @@ tbv& tbv_manager::set_or(tbv& dst,  tbv const& src) const {
     return dst;
 }
 bool tbv_manager::set_and(tbv& dst,  tbv const& src) const {
-    m.set_and(dst, src); 
-    return is_well_formed(dst);
+    // same as m.set_and(dst, src) followed by is_well_formed(dst), 
+    // but in a single pass over the words.
+    unsigned nw = m.num_words();
+    unsigned all = 0xFFFFFFFF;
+    unsigned w;
+    for (unsigned i = 0; i + 1 < nw; ++i) {
+        w = (dst.m_data[i] &= src.m_data[i]);
+        all &= w | (w << 1) | 0x55555555;
+    }
+    if (nw > 0) {
+        dst.m_data[nw - 1] &= src.m_data[nw - 1];
+        w = m.last_word(dst);
+        all &= w | (w << 1) | 0x55555555 | ~m.get_mask();
+    }
+    SASSERT((all == 0xFFFFFFFF) == is_well_formed(dst));
+    return all == 0xFFFFFFFF;
 }
 
 bool tbv_manager::is_well_formed(tbv const& dst) const {
@@ -21,19 +21,20 @@ Revision History:
 
 
 class opt_stream_buffer {
-    std::istream & m_stream;
-    int            m_val;
-    unsigned       m_line;
+    // read directly from the stream buffer, bypassing the sentry of std::istream::get()
+    std::streambuf * m_buf;
+    int              m_val;
+    unsigned         m_line;
 public:    
     opt_stream_buffer(std::istream & s):
-        m_stream(s),
+        m_buf(s.rdbuf()),
         m_line(0) {
-        m_val = m_stream.get();
+        m_val = m_buf->sbumpc();
     }
     int  operator *() const { return m_val;}
-    void operator ++() { m_val = m_stream.get(); }
+    void operator ++() { m_val = m_buf->sbumpc(); }
     int ch() const { return m_val; }
-    void next() { m_val = m_stream.get(); }
+    void next() { m_val = m_buf->sbumpc(); }
     bool eof() const { return ch() == EOF; }
     unsigned line() const { return m_line; }
     void skip_whitespace() {
@@ -117,6 +117,28 @@ namespace smt2 {
             signed char n = m_normalized[static_cast<unsigned char>(c)];
             if (n == 'a' || n == '0' || n == '-') {
                 m_string.push_back(c);
+                if (!m_interactive && !m_cache_input) {
+                    // consume the rest of the run directly from the buffer
+                    // instead of going through next() for every character.
+                    unsigned i = m_bpos;
+                    for (; i < m_bend; ++i) {
+                        c = m_buffer[i];
+                        n = m_normalized[static_cast<unsigned char>(c)];
+                        if (n != 'a' && n != '0' && n != '-')
+                            break;
+                        m_string.push_back(c);
+                    }
+                    if (i < m_bend) {
+                        m_spos += i - m_bpos + 1;
+                        m_curr = c;
+                        m_bpos = i + 1;
+                        continue;
+                    }
+                    if (i > m_bpos)
+                        m_curr = m_buffer[i - 1];
+                    m_spos += i - m_bpos;
+                    m_bpos = i;
+                }
                 next();
             }
             else {
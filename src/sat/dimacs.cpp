@@ -24,15 +24,17 @@ Revision History:
 struct lex_error {};
 
 class stream_buffer {
-    std::istream & m_stream;
-    int            m_val;
-    unsigned       m_line;
+    // characters are read directly from the stream buffer:
+    // std::istream::get() constructs a sentry for every character.
+    std::streambuf * m_buf;
+    int              m_val;
+    unsigned         m_line;
 public:
     
     stream_buffer(std::istream & s):
-        m_stream(s),
+        m_buf(s.rdbuf()),
         m_line(0) {
-        m_val = m_stream.get();
+        m_val = m_buf->sbumpc();
     }
 
     int  operator *() const { 
@@ -40,7 +42,7 @@ public:
     }
 
     void operator ++() { 
-        m_val = m_stream.get();
+        m_val = m_buf->sbumpc();
         if (m_val == '\n') ++m_line;
     }
 
@@ -83,8 +83,8 @@ namespace sat {
         for (unsigned i = 0; i < m_asymm_branch_rounds; ++i) {
             unsigned elim = m_elim_literals + m_tr;
             big.init(s, learned);
-            process(&big, s.m_clauses);
-            process(&big, s.m_learned);
+            process(&big, s.m_clauses, m_asymm_branch_limit);
+            process(&big, s.m_learned, m_asymm_branch_limit);
             process_bin(big);
             s.propagate(false); 
             if (s.m_inconsistent)
@@ -102,7 +102,15 @@ namespace sat {
     bool asymm_branch::process(bool learned) {
         unsigned eliml0 = m_elim_learned_literals;
         unsigned elim = m_elim_literals;
-        process(nullptr, s.m_clauses);
+        process(nullptr, s.m_clauses, m_asymm_branch_limit);
+        if (learned && m_asymm_branch_learned && !s.inconsistent()) {
+            // vivify learned clauses using propagation over all clauses.
+            // The pass has its own budget, so it is not starved by the problem clauses.
+            int64_t counter = m_counter;
+            m_counter = 0;
+            process(nullptr, s.m_learned, m_asymm_branch_learned_limit, true);
+            m_counter += counter;
+        }
         s.propagate(false); 
         IF_VERBOSE(4, if (m_elim_learned_literals > eliml0) 
                           verbose_stream() << "(sat-asymm-branch :elim " << m_elim_learned_literals - eliml0 << ")\n";);
@@ -110,8 +118,8 @@ namespace sat {
     }
 
 
-    void asymm_branch::process(big* big, clause_vector& clauses) {
-        int64_t limit = -m_asymm_branch_limit;
+    void asymm_branch::process(big* big, clause_vector& clauses, int64_t budget, bool vivify_learned) {
+        int64_t limit = -budget;
         std::stable_sort(clauses.begin(), clauses.end(), clause_size_lt());
         m_counter -= clauses.size();
         clause_vector::iterator it  = clauses.begin();
@@ -126,7 +134,8 @@ namespace sat {
                     break;
                 }
                 clause & c = *(*it);
-                if (m_counter < limit || s.inconsistent() || c.was_removed()) {
+                if (m_counter < limit || s.inconsistent() || c.was_removed() ||
+                    (vivify_learned && (c.was_vivified() || c.glue() <= m_asymm_branch_learned_glue))) {
                     *it2 = *it;
                     ++it2;
                     continue;
@@ -135,6 +144,8 @@ namespace sat {
                 if (big ? !process_sampled(*big, c) : !process(c)) {
                     continue; // clause was removed
                 }
+                if (vivify_learned)
+                    c.mark_vivified();
                 *it2 = *it;
                 ++it2;
             }
@@ -507,6 +518,9 @@ namespace sat {
         m_asymm_branch_sampled = p.asymm_branch_sampled();
         m_asymm_branch_limit   = p.asymm_branch_limit();
         m_asymm_branch_all     = p.asymm_branch_all();
+        m_asymm_branch_learned = p.asymm_branch_learned();
+        m_asymm_branch_learned_glue  = p.asymm_branch_learned_glue();
+        m_asymm_branch_learned_limit = p.asymm_branch_learned_limit();
         if (m_asymm_branch_limit > UINT_MAX)
             m_asymm_branch_limit = UINT_MAX;
     }
@@ -517,6 +531,7 @@ namespace sat {
     
     void asymm_branch::collect_statistics(statistics & st) const {
         st.update("sat elim literals", m_elim_literals);
+        st.update("sat elim learned literals", m_elim_learned_literals);
         st.update("sat tr", m_tr);
     }
 
@@ -43,7 +43,10 @@ namespace sat {
         unsigned   m_asymm_branch_delay;
         bool       m_asymm_branch_sampled;
         bool       m_asymm_branch_all;
+        bool       m_asymm_branch_learned;
+        unsigned   m_asymm_branch_learned_glue;
         int64_t    m_asymm_branch_limit;
+        int64_t    m_asymm_branch_learned_limit;
 
         // stats
         unsigned   m_elim_literals;
@@ -77,7 +80,7 @@ namespace sat {
 
         bool process_sampled(big& big, clause & c);
 
-        void process(big* big, clause_vector & c);
+        void process(big* big, clause_vector & c, int64_t budget, bool vivify_learned = false);
         
         bool process_all(clause & c);
 
@@ -32,6 +32,8 @@ namespace sat {
         m_used(false),
         m_frozen(false),
         m_reinit_stack(false),
+        m_vivified(false),
+        m_imported(false),
         m_inact_rounds(0),
         m_glue(255),
         m_psm(255) {
@@ -188,6 +190,8 @@ namespace sat {
         void * mem = m_allocator.allocate(size);
         clause * cls = new (mem) clause(m_id_gen.mk(), other.size(), other.m_lits, other.is_learned());
         cls->m_reinit_stack = other.on_reinit_stack();
+        cls->m_vivified = other.was_vivified();
+        cls->m_imported = other.was_imported();
         cls->m_glue   = other.glue();
         cls->m_psm    = other.psm();
         cls->m_frozen = other.frozen();
@@ -51,6 +51,8 @@ namespace sat {
         unsigned           m_used:1;
         unsigned           m_frozen:1;
         unsigned           m_reinit_stack:1;
+        unsigned           m_vivified:1;    // learned clause was already vivified by asymm_branch
+        unsigned           m_imported:1;    // clause was imported from another parallel solver and not yet used in a conflict
         unsigned           m_inact_rounds:8;
         unsigned           m_glue:8;
         unsigned           m_psm:8;  // transient field used during gc
@@ -88,6 +90,11 @@ namespace sat {
         void mark_used() { m_used = true; }
         void unmark_used() { m_used = false; }
         bool was_used() const { return m_used; }
+        void mark_vivified() { m_vivified = true; }
+        bool was_vivified() const { return m_vivified; }
+        void mark_imported() { m_imported = true; }
+        void unmark_imported() { m_imported = false; }
+        bool was_imported() const { return m_imported; }
         void inc_inact_rounds() { m_inact_rounds++; }
         void reset_inact_rounds() { m_inact_rounds = 0; }
         unsigned inact_rounds() const { return m_inact_rounds; }
@@ -143,6 +150,7 @@ namespace sat {
         clause_allocator();
         void          finalize();
         size_t        get_allocation_size() const { return m_allocator.get_allocation_size(); }
+        size_t        get_free_size() const { return m_allocator.get_free_size(); }
         clause *      get_clause(clause_offset cls_off) const;
         clause_offset get_offset(clause const * ptr) const;
         clause *      mk_clause(unsigned num_lits, literal const * lits, bool learned);
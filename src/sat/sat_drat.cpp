@@ -43,8 +43,7 @@ namespace sat {
     }
 
     drat::~drat() {
-        if (m_out) m_out->flush();
-        if (m_bout) m_bout->flush();
+        flush();
         dealloc(m_out);
         dealloc(m_bout);
         for (unsigned i = 0; i < m_proof.size(); ++i) {
@@ -74,25 +73,45 @@ namespace sat {
         }
     }
 
+    /**
+       \brief Proof steps are collected in m_buffer and handed to the output
+       stream in large blocks, instead of one stream write per clause.
+    */
+    static const unsigned DRAT_BUFFER_SIZE = 1 << 20;
+
+    void drat::flush_buffer() {
+        if (m_buffer.empty()) return;
+        std::ostream* out = m_out ? m_out : m_bout;
+        if (out) out->write(m_buffer.c_ptr(), m_buffer.size());
+        m_buffer.reset();
+    }
+
+    /**
+       \brief Write pending proof steps through to the proof file, so that the
+       proof is complete while the solver is still alive.
+    */
+    void drat::flush() {
+        flush_buffer();
+        if (m_out) m_out->flush();
+        if (m_bout) m_bout->flush();
+    }
+
     void drat::dump(unsigned n, literal const* c, status st) {
         if (st == status::asserted || st == status::external) {
             return;
         }
         
-        char buffer[10000];
         char digits[20];     // enough for storing unsigned
         char* lastd = digits + sizeof(digits);
         
-        unsigned len = 0;
         if (st == status::deleted) {
-            buffer[0] = 'd';
-            buffer[1] = ' ';
-            len = 2;
+            m_buffer.push_back('d');
+            m_buffer.push_back(' ');
         }
         for (unsigned i = 0; i < n; ++i) {
             literal lit = c[i];
             unsigned v = lit.var();            
-            if (lit.sign()) buffer[len++] = '-';
+            if (lit.sign()) m_buffer.push_back('-');
             char* d = lastd;
             while (v > 0) {                
                 d--;
@@ -100,18 +119,12 @@ namespace sat {
                 v /= 10;
                 SASSERT(d > digits);
             }
-	    SASSERT(len + lastd - d < sizeof(buffer));
-	    memcpy(buffer + len, d, lastd - d);
-	    len += static_cast<unsigned>(lastd - d);            
-	    buffer[len++] = ' ';
-	    if (len + 50 > sizeof(buffer)) {
-	        m_out->write(buffer, len);
-	        len = 0;
-            }
+            for (; d != lastd; ++d) m_buffer.push_back(*d);
+            m_buffer.push_back(' ');
         }        
-	buffer[len++] = '0';
-	buffer[len++] = '\n';
-	m_out->write(buffer, len);               
+        m_buffer.push_back('0');
+        m_buffer.push_back('\n');
+        if (m_buffer.size() >= DRAT_BUFFER_SIZE) flush_buffer();
     }
 
     void drat::bdump(unsigned n, literal const* c, status st) {
@@ -123,9 +136,7 @@ namespace sat {
         case status::deleted: ch = 'd'; break;
         default: UNREACHABLE(); break;
         }
-        char buffer[10000];
-        int len = 0;
-        buffer[len++] = ch;
+        m_buffer.push_back(ch);
 
         for (unsigned i = 0; i < n; ++i) {
             literal lit = c[i];
@@ -134,16 +145,12 @@ namespace sat {
                 ch = static_cast<unsigned char>(v & 255);
                 v >>= 7;
                 if (v) ch |= 128;
-                buffer[len++] = ch;
-                if (len == sizeof(buffer)) {
-                    m_bout->write(buffer, len);
-                    len = 0;
-                }
+                m_buffer.push_back(ch);
             }
             while (v);
         }
-        buffer[len++] = 0;
-        m_bout->write(buffer, len);
+        m_buffer.push_back(0);
+        if (m_buffer.size() >= DRAT_BUFFER_SIZE) flush_buffer();
     }
 
     bool drat::is_cleaned(clause& c) const {
@@ -648,8 +655,9 @@ namespace sat {
     }
 
     void drat::add() {
-        if (m_out) (*m_out) << "0\n";
+        if (m_out) dump(0, nullptr, status::learned);
         if (m_bout) bdump(0, nullptr, status::learned);
+        flush();
         if (m_check_unsat) {
             SASSERT(m_inconsistent);
         }
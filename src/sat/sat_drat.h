@@ -48,6 +48,7 @@ namespace sat {
         clause_allocator        m_alloc;
         std::ostream*           m_out;
         std::ostream*           m_bout;
+        svector<char>           m_buffer; // pending proof output for m_out or m_bout
         ptr_vector<clause>      m_proof;
         svector<status>         m_status;
         literal_vector          m_units;
@@ -56,6 +57,7 @@ namespace sat {
         bool                    m_inconsistent;
         bool                    m_check_unsat, m_check_sat, m_check;
 
+        void flush_buffer();
         void dump(unsigned n, literal const* c, status st);
         void bdump(unsigned n, literal const* c, status st);
         void append(literal l, status st);
@@ -86,6 +88,7 @@ namespace sat {
         ~drat();  
 
         void updt_config();
+        void flush();
         void add();
         void add(literal l, bool learned);
         void add(literal l1, literal l2, bool learned);
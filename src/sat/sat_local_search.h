@@ -118,10 +118,9 @@ namespace sat {
         struct constraint {
             unsigned        m_id;
             unsigned        m_k;
-            int             m_slack;
             unsigned        m_size;
             literal_vector  m_literals;
-            constraint(unsigned k, unsigned id) : m_id(id), m_k(k), m_slack(0), m_size(0) {}
+            constraint(unsigned k, unsigned id) : m_id(id), m_k(k), m_size(0) {}
             void push(literal l) { m_literals.push_back(l); ++m_size; }
             unsigned size() const { return m_size; }
             literal const& operator[](unsigned idx) const { return m_literals[idx]; }
@@ -136,6 +135,7 @@ namespace sat {
         vector<var_info>    m_vars;                      // variables
         svector<bool_var>   m_units;                     // unit clauses
         vector<constraint>  m_constraints;               // all constraints
+        svector<int>        m_slack;                     // slack of each constraint, kept dense for the scoring loops
         literal_vector      m_assumptions;               // temporary assumptions
         literal_vector      m_prop_queue;                // propagation queue
         unsigned            m_num_non_binary_clauses;       
@@ -193,7 +193,7 @@ namespace sat {
 
         unsigned num_constraints() const { return m_constraints.size(); } // constraint index from 1 to num_constraint
 
-        unsigned constraint_slack(unsigned ci) const { return m_constraints[ci].m_slack; }
+        int constraint_slack(unsigned ci) const { return m_slack[ci]; }
         
         void init();
         void reinit();
@@ -64,10 +64,12 @@ namespace sat {
         m_vectors[m_tail++] = e;
     }
 
-    void parallel::vector_pool::end_add_vector() {
+    bool parallel::vector_pool::end_add_vector() {
         if (m_tail >= m_size) {
             m_tail = 0;
+            return true;
         }
+        return false;
     }
 
 
@@ -146,32 +148,58 @@ namespace sat {
         }
     }
 
+    /**
+       \brief Check whether a clause with the same literals is already in the pool.
+       The hash is independent of the literal order since different solvers
+       learn the same clause with different orders. A hash collision only 
+       causes a clause not to be shared.
+    */
+    bool parallel::is_new_shared(unsigned n, literal const* lits) {
+        unsigned h = n;
+        for (unsigned i = 0; i < n; ++i) {
+            h += hash_u(lits[i].index());
+        }
+        if (m_shared.contains(h)) {
+            return false;
+        }
+        m_shared.insert(h);
+        return true;
+    }
+
+    void parallel::add_shared(solver& s, unsigned n, literal const* lits) {
+        if (!is_new_shared(n, lits)) {
+            s.m_stats.m_par_duplicates++;
+            return;
+        }
+        s.m_stats.m_par_exported++;
+        m_pool.begin_add_vector(s.m_par_id, n);
+        for (unsigned i = 0; i < n; ++i) {
+            m_pool.add_vector_elem(lits[i].index());
+        }
+        if (m_pool.end_add_vector()) {
+            // old clauses are overwritten from now on and may be shared again.
+            m_shared.reset();
+        }
+    }
+
     void parallel::share_clause(solver& s, literal l1, literal l2) {        
         if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  l1 << " " << l2 << "\n";);
+        literal lits[2] = { l1, l2 };
         #pragma omp critical (par_solver)
         {
-            m_pool.begin_add_vector(s.m_par_id, 2);
-            m_pool.add_vector_elem(l1.index());
-            m_pool.add_vector_elem(l2.index());            
-            m_pool.end_add_vector();
+            add_shared(s, 2, lits);
         }        
     }
 
     void parallel::share_clause(solver& s, clause const& c) {        
         if (s.get_config().m_num_threads == 1 || !enable_add(c) || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
-        unsigned n = c.size();
-        unsigned owner = s.m_par_id;
-        IF_VERBOSE(3, verbose_stream() << owner << ": share " <<  c << "\n";);
+        IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  c << "\n";);
         #pragma omp critical (par_solver)
         {
-            m_pool.begin_add_vector(owner, n);                
-            for (unsigned i = 0; i < n; ++i) {
-                m_pool.add_vector_elem(c[i].index());
-            }
-            m_pool.end_add_vector();
+            add_shared(s, c.size(), c.begin());
         }
     }
 
@@ -199,7 +227,9 @@ namespace sat {
             IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << m_lits << "\n";);
             SASSERT(n >= 2);
             if (usable_clause) {
-                s.mk_clause_core(m_lits.size(), m_lits.c_ptr(), true);
+                s.m_stats.m_par_imported++;
+                clause* c = s.mk_clause_core(m_lits.size(), m_lits.c_ptr(), true);
+                if (c) c->mark_imported();
             }
         }        
     }
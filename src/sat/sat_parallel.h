@@ -45,12 +45,14 @@ namespace sat {
             vector_pool() {}
             void reserve(unsigned num_owners, unsigned sz);
             void begin_add_vector(unsigned owner, unsigned n);
-            void end_add_vector();
+            bool end_add_vector();
             void add_vector_elem(unsigned e);
             bool get_vector(unsigned owner, unsigned& n, unsigned const*& ptr);
         };
 
         bool enable_add(clause const& c) const;
+        bool is_new_shared(unsigned n, literal const* lits);
+        void add_shared(solver& s, unsigned n, literal const* lits);
         void _get_clauses(solver& s);
         void _get_phase(solver& s);
         void _set_phase(solver& s);
@@ -60,6 +62,7 @@ namespace sat {
         index_set      m_unit_set;
         literal_vector m_lits;
         vector_pool    m_pool;
+        index_set      m_shared;   // hashes of clauses in the pool since it last wrapped around
 
         // for exchange with local search:
         svector<lbool>     m_phase;
@@ -82,7 +85,7 @@ namespace sat {
         void push_child(reslimit& rl);
 
         // reserve space
-        void reserve(unsigned num_owners, unsigned sz) { m_pool.reserve(num_owners, sz); }
+        void reserve(unsigned num_owners, unsigned sz) { m_pool.reserve(num_owners, sz); m_shared.reset(); }
 
         solver& get_solver(unsigned i) { return *m_solvers[i]; }
 
@@ -62,7 +62,10 @@ namespace sat {
 
     simplifier::simplifier(solver & _s, params_ref const & p):
         s(_s),
-        m_num_calls(0) {
+        m_num_calls(0),
+        m_sub_budget_shift(0),
+        m_learned_sub_budget_shift(0),
+        m_elim_budget_shift(0) {
         updt_params(p);
         reset_statistics();
     }
@@ -214,9 +217,11 @@ namespace sat {
             m_num_calls++;
         }
 
-        m_sub_counter  = m_subsumption_limit;
-        m_elim_counter = m_res_limit;
+        unsigned& sub_budget_shift = learned ? m_learned_sub_budget_shift : m_sub_budget_shift;
+        m_sub_counter  = m_subsumption_limit >> sub_budget_shift;
+        m_elim_counter = m_res_limit >> m_elim_budget_shift;
         m_old_num_elim_vars = m_num_elim_vars;
+        unsigned old_num_subsumed = m_num_subsumed + m_num_sub_res;
 
         for (bool_var v = 0; v < s.num_vars(); ++v) {
             if (!s.m_eliminated[v] && !is_external(v)) {
@@ -238,6 +243,12 @@ namespace sat {
         }
         while (!m_sub_todo.empty());
         bool vars_eliminated = m_num_elim_vars > m_old_num_elim_vars;
+        if (m_subsumption) {
+            update_budget_shift(m_num_subsumed + m_num_sub_res > old_num_subsumed, sub_budget_shift);
+        }
+        if (!learned && elim_vars_enabled()) {
+            update_budget_shift(vars_eliminated, m_elim_budget_shift);
+        }
 
         if (m_need_cleanup || vars_eliminated) {
             TRACE("after_simplifier", tout << "cleanning watches...\n";);
@@ -254,6 +265,25 @@ namespace sat {
         finalize();
     }
 
+    /**
+       \brief Adjust the budget of a simplification technique to its payoff in
+       the last round: techniques that keep finding nothing get exponentially
+       smaller budgets (down to 1/16 of the configured limit), a productive
+       round restores the full budget.
+    */
+    void simplifier::update_budget_shift(bool productive, unsigned& shift) {
+        if (productive) 
+            shift = 0;
+        else if (shift < 4) 
+            ++shift;
+    }
+
+    void simplifier::reset_budget_shifts() {
+        m_sub_budget_shift = 0;
+        m_learned_sub_budget_shift = 0;
+        m_elim_budget_shift = 0;
+    }
+
     /**
        \brief Eliminate all ternary and clause watches.
     */
@@ -2084,6 +2114,7 @@ namespace sat {
 
     void simplifier::updt_params(params_ref const & _p) {
         sat_simplifier_params p(_p);
+        reset_budget_shifts();
         m_cce                     = p.cce();
         m_acce                    = p.acce();
         m_bca                     = false && p.bca(); // disabled
@@ -2129,6 +2160,7 @@ namespace sat {
     }
 
     void simplifier::reset_statistics() {
+        reset_budget_shifts();
         m_num_bce = 0;
         m_num_cce = 0;
         m_num_acce = 0;
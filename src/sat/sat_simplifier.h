@@ -70,6 +70,12 @@ namespace sat {
         // counters
         int                    m_sub_counter;
         int                    m_elim_counter;
+        // budgets of subsumption and variable elimination are scaled down by 2^shift
+        // after rounds that did not pay off, and restored when they do.
+        // The learned and irredundant subsumption passes are scaled separately.
+        unsigned               m_sub_budget_shift;
+        unsigned               m_learned_sub_budget_shift;
+        unsigned               m_elim_budget_shift;
 
         // config
         bool                   m_abce; // block clauses using asymmetric added literals
@@ -161,6 +167,8 @@ namespace sat {
         void mark_as_not_learned(literal l1, literal l2);
 
         void cleanup_watches();
+        void update_budget_shift(bool productive, unsigned& shift);
+        void reset_budget_shifts();
         void move_clauses(clause_vector & cs, bool learned);
         void cleanup_clauses(clause_vector & cs, bool learned, bool vars_eliminated);
 
@@ -387,8 +387,8 @@ namespace sat {
                 m_clauses_to_reinit.push_back(clause_wrapper(l1, l2));
         }
         m_stats.m_mk_bin_clause++;
-        get_wlist(~l1).push_back(watched(l2, learned));
-        get_wlist(~l2).push_back(watched(l1, learned));
+        push_binary_watch(get_wlist(~l1), watched(l2, learned));
+        push_binary_watch(get_wlist(~l2), watched(l1, learned));
     }
 
     bool solver::propagate_bin_clause(literal l1, literal l2) {
@@ -542,9 +542,17 @@ namespace sat {
         }
     };
 
+    /**
+       \brief Defragment only when the holes left by deleted clauses make up
+       a sizable part of the clause memory. Copying the clause database at
+       every gc round costs time without improving locality much.
+    */
     bool solver::should_defrag() {
         if (m_defrag_threshold > 0) --m_defrag_threshold;
-        return m_defrag_threshold == 0 && m_config.m_gc_defrag;
+        return 
+            m_defrag_threshold == 0 && 
+            m_config.m_gc_defrag && 
+            4 * cls_allocator().get_free_size() > cls_allocator().get_allocation_size();
     }
 
     void solver::defrag_clauses() {
@@ -1074,6 +1082,7 @@ namespace sat {
     //
     // -----------------------
     lbool solver::check(unsigned num_lits, literal const* lits) {
+        scoped_drat_flush _flush(*this);
         init_reason_unknown();
         pop_to_base_level();
         m_stats.m_units = init_trail_size();
@@ -2451,6 +2460,10 @@ namespace sat {
                 break;
             case justification::CLAUSE: {
                 clause & c = get_clause(js);
+                if (c.was_imported()) {
+                    m_stats.m_par_imported_used++;
+                    c.unmark_imported();
+                }
                 unsigned i   = 0;
                 if (consequent != null_literal) {
                     SASSERT(c[0] == consequent || c[1] == consequent);
@@ -4475,6 +4488,10 @@ namespace sat {
         st.update("sat units", m_units);
         st.update("sat elim bool vars res", m_elim_var_res);
         st.update("sat elim bool vars bdd", m_elim_var_bdd);
+        st.update("sat par clauses exported", m_par_exported);
+        st.update("sat par clauses imported", m_par_imported);
+        st.update("sat par duplicates skipped", m_par_duplicates);
+        st.update("sat par imported used", m_par_imported_used);
     }
 
     void stats::reset() {
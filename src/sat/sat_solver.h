@@ -71,6 +71,10 @@ namespace sat {
         unsigned m_elim_var_res;
         unsigned m_elim_var_bdd;
         unsigned m_units;
+        unsigned m_par_exported;
+        unsigned m_par_imported;
+        unsigned m_par_duplicates;
+        unsigned m_par_imported_used;   // imported clauses that took part in conflict analysis
         stats() { reset(); }
         void reset();
         void collect_statistics(statistics & st) const;
@@ -267,6 +271,14 @@ namespace sat {
                 s.m_checkpoint_enabled = true;
             }
         };
+        class scoped_drat_flush {
+            solver& s;
+        public:
+            scoped_drat_flush(solver& s): s(s) {}
+            ~scoped_drat_flush() {
+                if (s.m_config.m_drat) s.m_drat.flush();
+            }
+        };
         unsigned select_watch_lit(clause const & cls, unsigned starting_at) const;
         unsigned select_learned_watch_lit(clause const & cls) const;
         bool simplify_clause(unsigned & num_lits, literal * lits) const;
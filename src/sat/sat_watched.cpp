@@ -40,6 +40,26 @@ namespace sat {
         return false;                                           
     }
 
+    void push_binary_watch(watch_list & wlist, watched const & w) {
+        SASSERT(w.is_binary_clause());
+        wlist.push_back(w);
+        unsigned last = wlist.size() - 1;
+        unsigned i = 0;
+        while (i < last && wlist[i].is_binary_clause())
+            ++i;
+        if (i == last)
+            return;
+        std::swap(wlist[i], wlist[last]);
+        if (!wlist[last].is_ternary_clause())
+            return;
+        // the displaced ternary watch goes back in front of the remaining watches
+        unsigned j = i + 1;
+        while (j < last && wlist[j].is_ternary_clause())
+            ++j;
+        if (j < last)
+            std::swap(wlist[j], wlist[last]);
+    }
+
     watched* find_binary_watch(watch_list & wlist, literal l) {
         for (watched& w : wlist) {
             if (w.is_binary_clause() && w.get_literal() == l) return &w;
@@ -134,6 +134,14 @@ namespace sat {
 
     typedef vector<watched> watch_list;
 
+    /**
+       \brief Add a binary watch to wlist keeping binary watches ahead of
+       ternary watches, and ternary watches ahead of the other watches (the
+       order established by watched_lt). Propagation then visits binary
+       watches, which need no clause dereference, first.
+    */
+    void push_binary_watch(watch_list & wlist, watched const & w);
+
     watched* find_binary_watch(watch_list & wlist, literal l);
     watched const* find_binary_watch(watch_list const & wlist, literal l);
     bool erase_clause_watch(watch_list & wlist, clause_offset c);
@@ -20,16 +20,20 @@ Revision History:
 
 namespace smt {
 
-    fingerprint::fingerprint(region & r, void * d, unsigned d_h, expr* def, unsigned n, enode * const * args):
+    fingerprint::fingerprint(void * d, unsigned d_h, expr* def, unsigned n, enode * const * args):
         m_data(d), 
         m_data_hash(d_h),
         m_def(def),
         m_num_args(n), 
-        m_args(nullptr) {
-        m_args = new (r) enode*[n];
+        m_args(reinterpret_cast<enode**>(this + 1)) {
         memcpy(m_args, args, sizeof(enode*) * n);
     }
 
+    fingerprint * fingerprint::mk(region & r, void * d, unsigned d_h, expr* def, unsigned n, enode * const * args) {
+        void * mem = r.allocate(sizeof(fingerprint) + sizeof(enode*) * n);
+        return new (mem) fingerprint(d, d_h, def, n, args);
+    }
+
     bool fingerprint_set::fingerprint_eq_proc::operator()(fingerprint const * f1, fingerprint const * f2) const {
         if (f1->get_data() != f2->get_data()) 
             return false;
@@ -69,16 +73,20 @@ namespace smt {
         TRACE("fingerprint_bug", tout << "1) inserting: " << data_hash << " num_args: " << num_args;
               for (unsigned i = 0; i < num_args; i++) tout << " " << args[i]->get_owner_id(); 
               tout << "\n";);
-        for (unsigned i = 0; i < num_args; i++)
-            d->m_args[i] = d->m_args[i]->get_root();
-        if (m_set.contains(d)) {
+        bool is_root = true;
+        for (unsigned i = 0; i < num_args; i++) {
+            enode * r = d->m_args[i]->get_root();
+            is_root &= r == d->m_args[i];
+            d->m_args[i] = r;
+        }
+        if (!is_root && m_set.contains(d)) {
             TRACE("fingerprint_bug", tout << "failed: " << data_hash << " num_args: " << num_args;
                   for (unsigned i = 0; i < num_args; i++) tout << " " << d->m_args[i]->get_owner_id(); 
                   tout << "\n";);
             return nullptr;
         }
         TRACE("fingerprint_bug", tout << "2) inserting: " << *d;);
-        fingerprint * f = new (m_region) fingerprint(m_region, data, data_hash, def, num_args, d->m_args);
+        fingerprint * f = fingerprint::mk(m_region, data, data_hash, def, num_args, d->m_args);
         m_fingerprints.push_back(f);
         m_defs.push_back(def);
         m_set.insert(f);
@@ -89,11 +97,13 @@ namespace smt {
         fingerprint * d = mk_dummy(data, data_hash, num_args, args);
         if (m_set.contains(d)) 
             return true;
-        for (unsigned i = 0; i < num_args; i++)
-            d->m_args[i] = d->m_args[i]->get_root();
-        if (m_set.contains(d))
-            return true;
-        return false;
+        bool is_root = true;
+        for (unsigned i = 0; i < num_args; i++) {
+            enode * r = d->m_args[i]->get_root();
+            is_root &= r == d->m_args[i];
+            d->m_args[i] = r;
+        }
+        return !is_root && m_set.contains(d);
     }
     
     void fingerprint_set::reset() {
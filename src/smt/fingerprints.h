@@ -34,8 +34,13 @@ namespace smt {
 
         friend class fingerprint_set;
         fingerprint() {}
+        fingerprint(void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
     public:
-        fingerprint(region & r, void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
+        /**
+           \brief Allocate a fingerprint in \c r. The arguments are stored inline, 
+           right after the fingerprint object, in the same region block.
+        */
+        static fingerprint * mk(region & r, void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
         void * get_data() const { return m_data; }
         expr * get_def() const { return m_def; }
         unsigned get_data_hash() const { return m_data_hash; }
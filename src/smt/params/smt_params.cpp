@@ -43,6 +43,7 @@ void smt_params::updt_local_params(params_ref const & _p) {
     m_core_validate = p.core_validate();
     m_logic = _p.get_sym("logic", m_logic);
     m_string_solver = p.string_solver();
+    m_lemma_gc_glue = p.lemma_gc_glue();
     model_params mp(_p);
     m_model_compact = mp.compact();
     if (_p.get_bool("arith.greatest_error_pivot", false))
@@ -126,6 +127,7 @@ void smt_params::display(std::ostream & out) const {
 
     DISPLAY_PARAM(m_lemma_gc_strategy);
     DISPLAY_PARAM(m_lemma_gc_half);
+    DISPLAY_PARAM(m_lemma_gc_glue);
     DISPLAY_PARAM(m_recent_lemmas_size);
     DISPLAY_PARAM(m_lemma_gc_initial);
     DISPLAY_PARAM(m_lemma_gc_factor);
@@ -39,7 +39,8 @@ enum phase_selection {
     PS_CACHING_CONSERVATIVE,
     PS_CACHING_CONSERVATIVE2, // similar to the previous one, but alternated default config from time to time.
     PS_RANDOM,
-    PS_OCCURRENCE
+    PS_OCCURRENCE,
+    PS_CACHING_REPHASE // phase caching, periodically replacing the cached phases by the best, default or inverted phases.
 };
 
 enum restart_strategy {
@@ -153,6 +154,7 @@ struct smt_params : public preprocessor_params,
     // -----------------------------------
     lemma_gc_strategy m_lemma_gc_strategy;
     bool              m_lemma_gc_half;
+    bool              m_lemma_gc_glue;     //!< rank lemmas by glue tiers before activity.
     unsigned          m_recent_lemmas_size;
     unsigned          m_lemma_gc_initial;
     double            m_lemma_gc_factor;
@@ -277,6 +279,7 @@ struct smt_params : public preprocessor_params,
         m_restart_agility_threshold(0.18),
         m_lemma_gc_strategy(LGC_FIXED),
         m_lemma_gc_half(false),
+        m_lemma_gc_glue(false),
         m_recent_lemmas_size(100),
         m_lemma_gc_initial(5000),
         m_lemma_gc_factor(1.1),
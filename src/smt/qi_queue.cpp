@@ -23,6 +23,7 @@ Revision History:
 #include "ast/ast_ll_pp.h"
 #include "ast/rewriter/var_subst.h"
 #include "util/stats.h"
+#include <algorithm>
 
 namespace smt {
 
@@ -149,6 +150,9 @@ namespace smt {
 
     void qi_queue::instantiate() {
         unsigned since_last_check = 0;
+        // release the cheapest instances first, so that a round cut short by
+        // resource limits has already produced the most promising instances.
+        std::stable_sort(m_new_entries.begin(), m_new_entries.end(), entry_cost_lt());
         for (entry & curr : m_new_entries) {
             fingerprint * f    = curr.m_qb;
             quantifier * qa    = static_cast<quantifier*>(f->get_data());
@@ -60,6 +60,9 @@ namespace smt {
             unsigned      m_instantiated:1;
             entry(fingerprint * f, float c, unsigned g):m_qb(f), m_cost(c), m_generation(g), m_instantiated(false) {}
         };
+        struct entry_cost_lt {
+            bool operator()(entry const & e1, entry const & e2) const { return e1.m_cost < e2.m_cost; }
+        };
         svector<entry>                m_new_entries;
         svector<entry>                m_delayed_entries;
         expr_ref_vector               m_instances;
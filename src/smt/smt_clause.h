@@ -64,7 +64,7 @@ namespace smt {
         static unsigned get_obj_size(unsigned num_lits, clause_kind k, bool has_atoms, bool has_del_eh, bool has_justification) {
             unsigned r = sizeof(clause) + sizeof(literal) * num_lits;
             if (k != CLS_AUX)
-                r += sizeof(unsigned);
+                r += 2 * sizeof(unsigned); // activity and glue
             /* dvitek: Fix alignment issues on 64-bit platforms.  The
              * 'if' statement below probably isn't worthwhile since
              * I'm guessing the allocator is probably going to round
@@ -81,6 +81,8 @@ namespace smt {
             return r;
         }
 
+        static const unsigned GLUE_USED_BIT = 1u << 31;
+
         unsigned const * get_activity_addr() const {
             return reinterpret_cast<unsigned const *>(m_lits + m_capacity);
         }
@@ -89,10 +91,18 @@ namespace smt {
             return reinterpret_cast<unsigned *>(m_lits + m_capacity);
         }
 
+        unsigned const * get_glue_addr() const {
+            return get_activity_addr() + 1;
+        }
+
+        unsigned * get_glue_addr() {
+            return get_activity_addr() + 1;
+        }
+
         clause_del_eh * const * get_del_eh_addr() const {
             unsigned const * addr = get_activity_addr();
             if (is_lemma())
-                addr ++;
+                addr += 2;
             /* dvitek: It would be better to use uintptr_t than
              * size_t, but we need to wait until c++11 support is
              * really available.
@@ -210,6 +220,38 @@ namespace smt {
             *(get_activity_addr()) = act;
         }
 
+        /**
+           \brief Return the literal block distance (number of distinct decision levels) 
+           of the lemma, as last measured. It is used to keep lemmas with small glue 
+           during lemma garbage collection.
+        */
+        unsigned get_glue() const {
+            SASSERT(is_lemma());
+            return *(get_glue_addr()) & ~GLUE_USED_BIT;
+        }
+
+        void set_glue(unsigned glue) {
+            SASSERT(is_lemma());
+            SASSERT(glue < GLUE_USED_BIT);
+            unsigned * addr = get_glue_addr();
+            *addr = (*addr & GLUE_USED_BIT) | glue;
+        }
+
+        /**
+           \brief The glue word also records whether the lemma was used in conflict 
+           resolution since the last lemma garbage collection.
+        */
+        bool is_used() const {
+            SASSERT(is_lemma());
+            return (*(get_glue_addr()) & GLUE_USED_BIT) != 0;
+        }
+
+        void set_used(bool f) {
+            SASSERT(is_lemma());
+            unsigned * addr = get_glue_addr();
+            *addr = f ? (*addr | GLUE_USED_BIT) : (*addr & ~GLUE_USED_BIT);
+        }
+
         clause_del_eh * get_del_eh() const {
             return m_has_del_eh ? *(get_del_eh_addr()) : nullptr;
         }
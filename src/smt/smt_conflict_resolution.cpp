@@ -505,8 +505,10 @@ namespace smt {
             case b_justification::CLAUSE: {
                 clause * cls = js.get_clause();
                 TRACE("conflict", m_ctx.display_clause_detail(tout, cls););
-                if (cls->is_lemma())
+                if (cls->is_lemma()) {
                     cls->inc_clause_activity();
+                    m_ctx.update_glue(cls);
+                }
                 unsigned num_lits = cls->get_num_literals();
                 unsigned i        = 0;
                 if (consequent != false_literal) {
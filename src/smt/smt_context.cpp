@@ -71,6 +71,9 @@ namespace smt {
         m_phase_cache_on(true),
         m_phase_counter(0),
         m_phase_default(false),
+        m_best_phase_size(0),
+        m_best_phase_id(0),
+        m_rephase_idx(0),
         m_conflict(null_b_justification),
         m_not_l(null_literal),
         m_conflict_resolution(mk_conflict_resolution(m, *this, m_dyn_ack_manager, p, m_assigned_literals, m_watches)),
@@ -1878,6 +1881,7 @@ namespace smt {
                 case PS_CACHING:
                 case PS_CACHING_CONSERVATIVE:
                 case PS_CACHING_CONSERVATIVE2:
+                case PS_CACHING_REPHASE:
                     if (m_phase_cache_on && d.m_phase_available) {
                         TRACE("phase_selection", tout << "using cached value, is_pos: " << m_bdata[var].m_phase << ", var: p" << var << "\n";);
                         is_pos = m_bdata[var].m_phase;
@@ -1938,6 +1942,55 @@ namespace smt {
         }
     }
 
+    /**
+       \brief Record the phases of the current assignment if it is the longest
+       assignment reached at a conflict since the last rephase.
+    */
+    void context::save_best_phase() {
+        unsigned sz = m_assigned_literals.size();
+        if (sz <= m_best_phase_size)
+            return;
+        m_best_phase_size = sz;
+        ++m_best_phase_id;
+        m_best_phase.reserve(get_num_bool_vars(), false);
+        m_best_phase_stamp.reserve(get_num_bool_vars(), 0);
+        for (literal l : m_assigned_literals) {
+            m_best_phase[l.var()] = !l.sign();
+            m_best_phase_stamp[l.var()] = m_best_phase_id;
+        }
+    }
+
+    /**
+       \brief Overwrite the cached phases following the cycle best, default, best, inverted.
+       The best phase is only applied to variables that were assigned when it was saved.
+    */
+    void context::rephase() {
+        unsigned kind = m_rephase_idx++ % 4;
+        unsigned num_vars = get_num_bool_vars();
+        TRACE("phase_selection", tout << "rephase kind: " << kind << "\n";);
+        for (unsigned v = 0; v < num_vars; ++v) {
+            bool_var_data & d = m_bdata[v];
+            switch (kind) {
+            case 0:
+            case 2:
+                if (v < m_best_phase_stamp.size() && m_best_phase_stamp[v] == m_best_phase_id) {
+                    d.m_phase_available = true;
+                    d.m_phase = m_best_phase[v];
+                }
+                break;
+            case 1:
+                d.m_phase_available = true;
+                d.m_phase = m_phase_default;
+                break;
+            default:
+                if (d.m_phase_available)
+                    d.m_phase = !d.m_phase;
+                break;
+            }
+        }
+        m_best_phase_size = 0;
+    }
+
     /**
        \brief Create an internal backtracking point
     */
@@ -2692,8 +2745,60 @@ namespace smt {
         SASSERT(check_clauses(m_lemmas) && check_clauses(m_aux_clauses));
     }
 
+    /**
+       When m_lemma_gc_glue is set, lemmas are split in tiers by glue: core lemmas 
+       (glue <= CORE_GLUE) are not garbage collected, tier-2 lemmas (glue <= TIER2_GLUE) 
+       are preferred over the remaining (local) lemmas, and activity is used within 
+       each tier. A core lemma that was not used since the previous garbage collection 
+       is demoted to tier-2 (see demote_unused_core_lemmas). Otherwise, all lemmas are 
+       in the same tier and only activity is used.
+    */
+    static const unsigned CORE_GLUE  = 2;
+    static const unsigned TIER2_GLUE = 6;
+
+    static unsigned glue_tier(clause const * cls, bool use_glue) {
+        if (!use_glue)
+            return 2;
+        unsigned glue = cls->get_glue();
+        return glue <= CORE_GLUE ? 0 : (glue <= TIER2_GLUE ? 1 : 2);
+    }
+
+    void context::update_glue(clause * cls) const {
+        if (!m_fparams.m_lemma_gc_glue)
+            return;
+        cls->set_used(true);
+        unsigned glue = cls->get_glue();
+        if (glue <= CORE_GLUE)
+            return;
+        unsigned levels[TIER2_GLUE + 1];
+        unsigned num_levels = 0, num_undef = 0;
+        for (literal l : *cls) {
+            if (get_assignment(l) == l_undef) {
+                ++num_undef;
+            }
+            else {
+                unsigned lvl = get_assign_level(l);
+                unsigned i = 0;
+                for (; i < num_levels && levels[i] != lvl; ++i) 
+                    ;
+                if (i == num_levels)
+                    levels[num_levels++] = lvl;
+            }
+            if (num_levels + num_undef >= glue || num_levels + num_undef > TIER2_GLUE)
+                return;
+        }
+        cls->set_glue(num_levels + num_undef);
+    }
+
     struct clause_lt {
-        bool operator()(clause * cls1, clause * cls2) const { return cls1->get_activity() > cls2->get_activity(); }
+        bool m_use_glue;
+        clause_lt(bool use_glue): m_use_glue(use_glue) {}
+        bool operator()(clause * cls1, clause * cls2) const { 
+            unsigned t1 = glue_tier(cls1, m_use_glue), t2 = glue_tier(cls2, m_use_glue);
+            if (t1 != t2)
+                return t1 < t2;
+            return cls1->get_activity() > cls2->get_activity(); 
+        }
     };
 
     /**
@@ -2702,7 +2807,9 @@ namespace smt {
     inline void context::del_inactive_lemmas() {
         if (m_fparams.m_lemma_gc_strategy == LGC_NONE)
             return;
-        else if (m_fparams.m_lemma_gc_half)
+        if (m_fparams.m_lemma_gc_glue)
+            demote_unused_core_lemmas();
+        if (m_fparams.m_lemma_gc_half)
             del_inactive_lemmas1();
         else
             del_inactive_lemmas2();
@@ -2712,6 +2819,22 @@ namespace smt {
             m_lemma_gc_threshold = static_cast<unsigned>(m_lemma_gc_threshold * m_fparams.m_lemma_gc_factor);
     }
 
+    /**
+       \brief Move core lemmas that were not used in conflict resolution since the
+       last lemma garbage collection to tier-2, so the core tier does not grow without
+       bound. A demoted lemma is promoted again by update_glue if it is used and its 
+       glue is still small.
+    */
+    void context::demote_unused_core_lemmas() {
+        unsigned start_at = m_base_lvl == 0 ? 0 : m_base_scopes[m_base_lvl - 1].m_lemmas_lim;
+        for (unsigned i = start_at; i < m_lemmas.size(); ++i) {
+            clause * cls = m_lemmas[i];
+            if (!cls->is_used() && cls->get_glue() <= CORE_GLUE)
+                cls->set_glue(CORE_GLUE + 1);
+            cls->set_used(false);
+        }
+    }
+
     /**
        \brief Delete (approx.) half of low activity lemmas
     */
@@ -2725,7 +2848,7 @@ namespace smt {
         SASSERT (m_fparams.m_recent_lemmas_size < sz);
         unsigned end_at        = sz - m_fparams.m_recent_lemmas_size;
         SASSERT(start_at < end_at);
-        std::stable_sort(m_lemmas.begin() + start_at, m_lemmas.begin() + end_at, clause_lt());
+        std::stable_sort(m_lemmas.begin() + start_at, m_lemmas.begin() + end_at, clause_lt(m_fparams.m_lemma_gc_glue));
         unsigned start_del_at  = (start_at + end_at) / 2;
         unsigned i             = start_del_at;
         unsigned j             = i;
@@ -2734,7 +2857,7 @@ namespace smt {
               << ", start_del_at: " << start_del_at << "\n";);
         for (; i < end_at; i++) {
             clause * cls = m_lemmas[i];
-            if (can_delete(cls)) {
+            if (can_delete(cls) && (cls->deleted() || glue_tier(cls, m_fparams.m_lemma_gc_glue) > 0)) {
                 TRACE("del_inactive_lemmas", tout << "deleting: "; display_clause(tout, cls); tout << ", activity: " <<
                       cls->get_activity() << "\n";);
                 del_clause(cls);
@@ -2800,7 +2923,7 @@ namespace smt {
                 // The activity threshold depends on how old the clause is.
                 unsigned act_threshold = m_fparams.m_old_clause_activity -
                     (m_fparams.m_old_clause_activity - m_fparams.m_new_clause_activity) * ((i - start_at) / real_sz);
-                if (cls->get_activity() < act_threshold) {
+                if (cls->get_activity() < act_threshold && glue_tier(cls, m_fparams.m_lemma_gc_glue) > 0) {
                     unsigned rel_threshold = (i >= new_first_idx ? m_fparams.m_new_clause_relevancy : m_fparams.m_old_clause_relevancy);
                     if (more_than_k_unassigned_literals(cls, rel_threshold)) {
                         del_clause(cls);
@@ -3628,6 +3751,8 @@ namespace smt {
             // execute the restart
             m_stats.m_num_restarts++;
             m_num_restarts++;
+            if (m_fparams.m_phase_selection == PS_CACHING_REPHASE && m_num_restarts % 8 == 0)
+                rephase();
             if (m_scope_lvl > curr_lvl) {
                 pop_scope(m_scope_lvl - curr_lvl);
                 SASSERT(at_search_level());
@@ -3898,6 +4023,8 @@ namespace smt {
         }
         if (m_fparams.m_phase_selection == PS_CACHING_CONSERVATIVE || m_fparams.m_phase_selection == PS_CACHING_CONSERVATIVE2)
             forget_phase_of_vars_in_current_level();
+        if (m_fparams.m_phase_selection == PS_CACHING_REPHASE)
+            save_best_phase();
         m_atom_propagation_queue.reset();
         m_eq_propagation_queue.reset();
         m_th_eq_propagation_queue.reset();
@@ -183,6 +183,11 @@ namespace smt {
         bool                        m_phase_cache_on;
         unsigned                    m_phase_counter; //!< auxiliary variable used to decide when to turn on/off phase caching
         bool                        m_phase_default; //!< default phase when using phase caching
+        svector<bool>               m_best_phase;       //!< phases of the longest conflicting assignment since the last rephase
+        unsigned                    m_best_phase_size;  //!< number of literals assigned when m_best_phase was saved
+        unsigned_vector             m_best_phase_stamp; //!< m_best_phase_stamp[v] == m_best_phase_id if v is in m_best_phase
+        unsigned                    m_best_phase_id;    //!< incremented each time m_best_phase is saved
+        unsigned                    m_rephase_idx;      //!< position in the rephasing cycle
 
         // A conflict is usually a single justification. That is, a justification
         // for false. If m_not_l is not null_literal, then m_conflict is a
@@ -460,6 +465,13 @@ namespace smt {
             return get_assign_level(l.var());
         }
 
+        /**
+           \brief Lower the glue of the lemma \c cls to the number of distinct scope levels
+           of its literals (unassigned literals count as levels of their own).
+           Glues above the tier-2 bound are not measured exactly.
+        */
+        void update_glue(clause * cls) const;
+
         /**
            \brief Return the scope level when v was internalized.
         */
@@ -1077,6 +1089,10 @@ namespace smt {
 
         void update_phase_cache_counter();
 
+        void save_best_phase();
+
+        void rephase();
+
 #define ACTIVITY_LIMIT 1e100
 #define INV_ACTIVITY_LIMIT 1e-100
 
@@ -1125,6 +1141,8 @@ namespace smt {
 
         void del_inactive_lemmas();
 
+        void demote_unused_core_lemmas();
+
         void del_inactive_lemmas1();
 
         void del_inactive_lemmas2();
@@ -499,6 +499,12 @@ namespace smt {
 
     void model_checker::check_quantifiers(bool strict_rec_fun, bool& found_relevant, unsigned& num_failures) {
         for (quantifier * q : *m_qm) {
+            if (m_context->get_cancel_flag()) {
+                // the remaining auxiliary checks would return immediately with unknown,
+                // but each of them still pays for building and asserting the negated body.
+                num_failures++;
+                break;
+            }
             if (!(m_qm->mbqi_enabled(q) &&
                   m_context->is_relevant(q) &&
                   m_context->get_assignment(q) == l_true &&
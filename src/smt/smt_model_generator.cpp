@@ -393,6 +393,9 @@ namespace smt {
     */
     void model_generator::mk_func_interps() {
         unsigned sz = m_context->get_num_e_internalized();
+        // if the theory solvers are incomplete, then we cannot assume the e-graph is close under congruence
+        bool check_entries = m_context->get_last_search_failure() == smt::THEORY;
+        ptr_buffer<expr> args;
         for (unsigned i = 0; i < sz; i++) {
             expr * t  = m_context->get_e_internalized(i);
             if (!m_context->is_relevant(t))
@@ -404,7 +407,7 @@ namespace smt {
                 m_model->register_decl(f, get_value(n));
             }
             else if (num_args > 0 && n->get_cg() == n && include_func_interp(f)) {
-                ptr_buffer<expr> args;
+                args.reset();
                 expr * result = get_value(n);
                 SASSERT(result);
                 for (unsigned j = 0; j < num_args; j++) {
@@ -427,8 +430,7 @@ namespace smt {
                       }
                       tout << "\n";
                       tout << "value: #" << n->get_owner_id() << "\n" << mk_ismt2_pp(result, m_manager) << "\n";);
-                if (m_context->get_last_search_failure() == smt::THEORY) {
-                    // if the theory solvers are incomplete, then we cannot assume the e-graph is close under congruence
+                if (check_entries) {
                     if (fi->get_entry(args.c_ptr()) == nullptr)
                         fi->insert_new_entry(args.c_ptr(), result);
                 }
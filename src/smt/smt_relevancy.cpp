@@ -131,8 +131,8 @@ namespace smt {
         expr_ref_vector                m_relevant_exprs; 
         uint_set                       m_is_relevant;
         typedef list<relevancy_eh *>   relevancy_ehs;
-        obj_map<expr, relevancy_ehs *> m_relevant_ehs;
-        obj_map<expr, relevancy_ehs *> m_watches[2];
+        ptr_vector<relevancy_ehs>      m_relevant_ehs; // indexed by expression id
+        ptr_vector<relevancy_ehs>      m_watches[2];   // indexed by expression id
         struct eh_trail {
             enum kind { POS_WATCH, NEG_WATCH, HANDLER };
             kind   m_kind;
@@ -159,31 +159,19 @@ namespace smt {
         }
 
         relevancy_ehs * get_handlers(expr * n) {
-            relevancy_ehs * r = nullptr;
-            m_relevant_ehs.find(n, r);
-            SASSERT(m_relevant_ehs.contains(n) || r == 0);
-            return r;
+            return m_relevant_ehs.get(n->get_id(), nullptr);
         }
 
         void set_handlers(expr * n, relevancy_ehs * ehs) {
-            if (ehs == nullptr)
-                m_relevant_ehs.erase(n);
-            else
-                m_relevant_ehs.insert(n, ehs);
+            m_relevant_ehs.setx(n->get_id(), ehs, nullptr);
         }
 
         relevancy_ehs * get_watches(expr * n, bool val) {
-            relevancy_ehs * r = nullptr;
-            m_watches[val ? 1 : 0].find(n, r);
-            SASSERT(m_watches[val ? 1 : 0].contains(n) || r == 0);
-            return r;
+            return m_watches[val ? 1 : 0].get(n->get_id(), nullptr);
         }
 
         void set_watches(expr * n, bool val, relevancy_ehs * ehs) {
-            if (ehs == nullptr)
-                m_watches[val ? 1 : 0].erase(n);
-            else
-                m_watches[val ? 1 : 0].insert(n, ehs);
+            m_watches[val ? 1 : 0].setx(n->get_id(), ehs, nullptr);
         }
 
         void push_trail(eh_trail const & t) {
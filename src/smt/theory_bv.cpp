@@ -828,7 +828,6 @@ namespace smt {
     MK_UNARY(internalize_redor,     mk_redor);
 
     MK_AC_BINARY(internalize_add,      mk_adder);
-    MK_AC_BINARY(internalize_mul,      mk_multiplier);
     MK_BINARY(internalize_udiv,     mk_udiv);
     MK_BINARY(internalize_sdiv,     mk_sdiv);
     MK_BINARY(internalize_urem,     mk_urem);
@@ -847,6 +846,46 @@ namespace smt {
     MK_AC_BINARY(internalize_xnor,     mk_xnor);
     MK_BINARY(internalize_comp,     mk_comp);
 
+    /**
+       \brief Store in bits the multiplier circuit for the arguments of e.
+    */
+    void theory_bv::mk_mul_bits(enode * e, expr_ref_vector & bits) {
+        ast_manager & m = get_manager();
+        expr_ref_vector arg_bits(m), new_bits(m);
+        unsigned i = e->get_owner()->get_num_args();
+        --i;
+        get_arg_bits(e, i, bits);
+        while (i > 0) {
+            --i;
+            arg_bits.reset();
+            get_arg_bits(e, i, arg_bits);
+            SASSERT(arg_bits.size() == bits.size());
+            new_bits.reset();
+            m_bb.mk_multiplier(arg_bits.size(), arg_bits.c_ptr(), bits.c_ptr(), new_bits);
+            bits.swap(new_bits);
+        }
+    }
+
+    /**
+       \brief When bv.delay is set, a multiplier only gets fresh bits at internalization time.
+       Its circuit is produced by final_check_eh if the assignment violates its semantics.
+    */
+    void theory_bv::internalize_mul(app * n) {
+        SASSERT(!get_context().e_internalized(n));
+        SASSERT(n->get_num_args() >= 2);
+        process_args(n);
+        enode * e = mk_enode(n);
+        if (m_params.m_bv_delay) {
+            mk_bits(e->get_th_var(get_id()));
+            m_trail_stack.push(push_back_vector<theory_bv, ptr_vector<app>>(m_delayed_mul));
+            m_delayed_mul.push_back(n);
+            return;
+        }
+        expr_ref_vector bits(get_manager());
+        mk_mul_bits(e, bits);
+        init_bits(e, bits);
+    }
+
 #define MK_PARAMETRIC_UNARY(NAME, BLAST_OP)                                     \
     void theory_bv::NAME(app * n) {                                             \
         SASSERT(!get_context().e_internalized(n));                              \
@@ -1449,15 +1488,126 @@ namespace smt {
         theory::pop_scope_eh(num_scopes);
     }
 
+    /**
+       \brief Return l_false if the value of n differs from the product of the values of its arguments.
+       Return l_undef if some bits of n or of its arguments are unassigned, these bits are
+       marked as relevant so that the core assigns them.
+    */
+    lbool theory_bv::is_delayed_mul_consistent(app * n) {
+        context & ctx = get_context();
+        enode * e = ctx.get_enode(n);
+        numeral val, arg_val, product(1);
+        bool fixed = true;
+        for (unsigned i = 0; i < n->get_num_args(); ++i) {
+            theory_var v = get_arg_var(e, i);
+            if (get_fixed_value(v, arg_val))
+                product *= arg_val;
+            else
+                fixed = false;
+        }
+        fixed = get_fixed_value(get_var(e), val) && fixed;
+        if (!fixed) {
+            for (unsigned i = 0; i < n->get_num_args(); ++i)
+                for (literal lit : m_bits[get_arg_var(e, i)])
+                    ctx.mark_as_relevant(lit);
+            for (literal lit : m_bits[get_var(e)])
+                ctx.mark_as_relevant(lit);
+            return l_undef;
+        }
+        product = mod(product, power(numeral(2), get_bv_size(e)));
+        return val == product ? l_true : l_false;
+    }
+
+    /**
+       \brief Add the multiplier circuit of the delayed term n, constraining its bits.
+    */
+    void theory_bv::blast_delayed_mul(app * n) {
+        context & ctx = get_context();
+        ast_manager & m = get_manager();
+        enode * e = ctx.get_enode(n);
+        TRACE("bv", tout << "blast " << mk_bounded_pp(n, m) << "\n";);
+        m_stats.m_num_mul_blast++;
+        m_trail_stack.push(insert_obj_trail<theory_bv, app>(m_blasted_mul, n));
+        m_blasted_mul.insert(n);
+        expr_ref_vector bits(m);
+        mk_mul_bits(e, bits);
+        // copy: internalizing the circuit may create new theory variables.
+        literal_vector n_bits(m_bits[get_var(e)]);
+        for (unsigned i = 0; i < n_bits.size(); ++i) {
+            expr_ref s_bit(m);
+            simplify_bit(bits.get(i), s_bit);
+            ctx.internalize(s_bit, true);
+            literal l = ctx.get_literal(s_bit.get());
+            ctx.mark_as_relevant(l);
+            ctx.mk_th_axiom(get_id(), ~n_bits[i], l);
+            ctx.mk_th_axiom(get_id(), n_bits[i], ~l);
+        }
+    }
+
+    /**
+       \brief Blast the relevant delayed multipliers that are violated by the current assignment.
+       Return true if all of them are satisfied.
+
+       A circuit blasted above the search level is lost on backtracking, so the violated
+       multiplier is also queued and blasted again once the search level is reached.
+    */
+    bool theory_bv::check_delayed_mul() {
+        context & ctx = get_context();
+        bool ok = true;
+        for (unsigned i = 0; i < m_delayed_mul.size(); ++i) {
+            app * n = m_delayed_mul[i];
+            if (m_blasted_mul.contains(n) || !ctx.is_relevant(n))
+                continue;
+            switch (is_delayed_mul_consistent(n)) {
+            case l_true:
+                break;
+            case l_false:
+                if (ctx.get_scope_level() > ctx.get_search_level())
+                    m_pending_mul.insert(n);
+                blast_delayed_mul(n);
+                ok = false;
+                break;
+            case l_undef:
+                ok = false;
+                break;
+            }
+        }
+        return ok;
+    }
+
     final_check_status theory_bv::final_check_eh() {
         SASSERT(check_invariant());
+        if (!check_delayed_mul()) {
+            return FC_CONTINUE;
+        }
         if (m_approximates_large_bvs) {
             return FC_GIVEUP;
         }
         return FC_DONE;
     }
 
+    /**
+       \brief Blast the queued multipliers at the search level. Their circuits then
+       survive restarts and are only removed together with the enclosing user scope.
+    */
+    void theory_bv::blast_pending_mul() {
+        if (m_pending_mul.empty())
+            return;
+        SASSERT(get_context().at_search_level());
+        for (unsigned i = 0; i < m_delayed_mul.size(); ++i) {
+            app * n = m_delayed_mul[i];
+            if (m_pending_mul.contains(n) && !m_blasted_mul.contains(n))
+                blast_delayed_mul(n);
+        }
+        m_pending_mul.reset();
+    }
+
+    void theory_bv::restart_eh() {
+        blast_pending_mul();
+    }
+
     void theory_bv::reset_eh() {
+        m_pending_mul.reset();
         pop_scope_eh(m_trail_stack.get_num_scopes());
         m_bool_var2atom.reset();
         m_fixed_var_table.reset();
@@ -1612,6 +1762,10 @@ namespace smt {
         return true;
     }
 
+    bool theory_bv::can_propagate() {
+        return !m_replay_diseq.empty() || (!m_pending_mul.empty() && get_context().at_search_level());
+    }
+
     void theory_bv::propagate() {
         unsigned sz = m_replay_diseq.size();
         if (sz > 0) {
@@ -1621,6 +1775,8 @@ namespace smt {
             }
             m_replay_diseq.reset();
         }
+        if (get_context().at_search_level())
+            blast_pending_mul();
     }
 
     class bit_eq_justification : public justification {
@@ -1786,6 +1942,7 @@ namespace smt {
         st.update("bv bit2core", m_stats.m_num_bit2core);
         st.update("bv->core eq", m_stats.m_num_th2core_eq);
         st.update("bv dynamic eqs", m_stats.m_num_eq_dynamic);
+        st.update("bv mul blast", m_stats.m_num_mul_blast);
     }
 
 #ifdef Z3DEBUG
@@ -31,7 +31,7 @@ namespace smt {
     
     struct theory_bv_stats {
         unsigned   m_num_diseq_static, m_num_diseq_dynamic, m_num_bit2core, m_num_th2core_eq, m_num_conflicts;
-        unsigned   m_num_eq_dynamic;
+        unsigned   m_num_eq_dynamic, m_num_mul_blast;
         void reset() { memset(this, 0, sizeof(theory_bv_stats)); }
         theory_bv_stats() { reset(); }
     };
@@ -134,6 +134,9 @@ namespace smt {
         literal_vector           m_tmp_literals;
         svector<var_pos>         m_prop_queue;
         bool                     m_approximates_large_bvs;
+        ptr_vector<app>          m_delayed_mul;  // multipliers whose circuit is postponed (bv.delay)
+        obj_hashtable<app>       m_blasted_mul;  // delayed multipliers whose circuit is asserted
+        obj_hashtable<app>       m_pending_mul;  // violated delayed multipliers to be blasted at the search level
 
         theory_var find(theory_var v) const { return m_find.find(v); }
         theory_var next(theory_var v) const { return m_find.next(v); }
@@ -177,6 +180,11 @@ namespace smt {
         void internalize_add(app * n);
         void internalize_sub(app * n);
         void internalize_mul(app * n);
+        void mk_mul_bits(enode * e, expr_ref_vector & bits);
+        lbool is_delayed_mul_consistent(app * n);
+        void blast_delayed_mul(app * n);
+        bool check_delayed_mul();
+        void blast_pending_mul();
         void internalize_udiv(app * n);
         void internalize_sdiv(app * n);
         void internalize_urem(app * n);
@@ -236,11 +244,12 @@ namespace smt {
         void push_scope_eh() override;
         void pop_scope_eh(unsigned num_scopes) override;
         final_check_status final_check_eh() override;
+        void restart_eh() override;
         void reset_eh() override;
         bool include_func_interp(func_decl* f) override;
         svector<theory_var>   m_merge_aux[2]; //!< auxiliary vector used in merge_zero_one_bits
         bool merge_zero_one_bits(theory_var r1, theory_var r2);
-        bool can_propagate() override { return !m_replay_diseq.empty(); }
+        bool can_propagate() override;
         void propagate() override;
 
         // -----------------------------------
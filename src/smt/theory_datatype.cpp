@@ -264,6 +264,7 @@ namespace smt {
         var_data * d  = m_var_data[r];
         context & ctx   = get_context();
         ctx.attach_th_var(n, this, r);
+        m_oc_dirty = true;
         if (is_constructor(n)) {
             d->m_constructor = n;
             assert_accessor_axioms(n);
@@ -456,12 +457,17 @@ namespace smt {
         int num_vars = get_num_vars();
         final_check_status r = FC_DONE;
         final_check_st _guard(this); // RAII for managing state
+        // Backtracking only splits classes and removes constructors, so a graph
+        // found acyclic remains acyclic until new variables or merges are added.
+        bool check_oc = m_oc_dirty;
+        m_oc_dirty = false;
         for (int v = 0; v < num_vars; v++) {
             if (v == static_cast<int>(m_find.find(v))) {
                 enode * node = get_enode(v);
-                if (!oc_cycle_free(node) && occurs_check(node)) {
+                if (check_oc && !oc_cycle_free(node) && occurs_check(node)) {
                     // conflict was detected... 
                     // return...
+                    m_oc_dirty = true;
                     return FC_CONTINUE;
                 }
                 if (m_params.m_dt_lazy_splits > 0) {
@@ -618,6 +624,7 @@ namespace smt {
         theory::reset_eh();
         m_util.reset();
         m_stats.reset();
+        m_oc_dirty = true;
     }
 
     bool theory_datatype::is_shared(theory_var v) const {
@@ -633,7 +640,8 @@ namespace smt {
         m_params(p),
         m_util(m),
         m_find(*this),
-        m_trail_stack(*this) {
+        m_trail_stack(*this),
+        m_oc_dirty(true) {
     }
 
     theory_datatype::~theory_datatype() {
@@ -710,6 +718,7 @@ namespace smt {
         // v1 is the new root
         TRACE("datatype", tout << "merging v" << v1 << " v" << v2 << "\n";);
         SASSERT(v1 == static_cast<int>(m_find.find(v1)));
+        m_oc_dirty = true;
         var_data * d1 = m_var_data[v1];
         var_data * d2 = m_var_data[v2];
         if (d2->m_constructor != nullptr) {
@@ -53,6 +53,7 @@ namespace smt {
         th_trail_stack            m_trail_stack;
         datatype_factory *        m_factory;
         stats                     m_stats;
+        bool                      m_oc_dirty; //!< the constructor graph may have changed since the last acyclic occurs check.
 
         bool is_constructor(app * f) const { return m_util.is_constructor(f); }
         bool is_recognizer(app * f) const { return m_util.is_recognizer(f); }
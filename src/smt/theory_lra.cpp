@@ -1610,7 +1610,13 @@ public:
                 }
             }
         }
-        if (!coeffs.empty() && coeffs.begin()->m_value.is_neg()) {
+        // normalize the sign on the first variable, so that the same cut
+        // is mapped to the same atom independently of the order in coeffs.
+        theory_var first = null_theory_var;
+        for (auto const& kv : coeffs) 
+            if (first == null_theory_var || kv.m_key < static_cast<unsigned>(first))
+                first = kv.m_key;
+        if (first != null_theory_var && coeffs[first].is_neg()) {
             offset.neg();
             lower_bound = !lower_bound;
             for (auto& kv : coeffs) kv.m_value.neg();
@@ -3380,17 +3386,23 @@ public:
 
     app_ref coeffs2app(u_map<rational> const& coeffs, rational const& offset, bool is_int) {
         expr_ref_vector args(m);
-         for (auto const& kv : coeffs) {
-            theory_var w = kv.m_key;
+        // visit the variables in a fixed order, so that equal coefficient maps
+        // produce the same (hash-consed) term.
+        svector<theory_var> vars;
+        for (auto const& kv : coeffs) 
+            vars.push_back(kv.m_key);
+        std::sort(vars.begin(), vars.end());
+        for (theory_var w : vars) {
+            rational const& c = coeffs[w];
             expr* o = get_enode(w)->get_owner();
-            if (kv.m_value.is_zero()) {
+            if (c.is_zero()) {
                 // continue
             }
-            else if (kv.m_value.is_one()) {
+            else if (c.is_one()) {
                 args.push_back(o);
             }
             else {
-                args.push_back(a.mk_mul(a.mk_numeral(kv.m_value, is_int), o));                
+                args.push_back(a.mk_mul(a.mk_numeral(c, is_int), o));                
             }
         }
         if (!offset.is_zero()) {
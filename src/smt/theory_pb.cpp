@@ -454,6 +454,12 @@ namespace smt {
         return alloc(theory_pb, new_ctx->get_manager(), m_params); 
     }
 
+    struct coeff_gt {
+        bool operator()(std::pair<literal, rational> const& a, std::pair<literal, rational> const& b) const {
+            return a.second > b.second;
+        }
+    };
+
     bool theory_pb::internalize_atom(app * atom, bool gate_ctx) {
         context& ctx = get_context();
         ast_manager& m = get_manager();
@@ -547,6 +553,9 @@ namespace smt {
         c->unique();
         lbool is_true = c->normalize();
         c->prune();
+        // order by decreasing coefficients: the initial watches then cover
+        // k + max_watch with as few literals as possible.
+        std::stable_sort(c->m_args[0].begin(), c->m_args[0].end(), coeff_gt());
         c->post_prune();
 
         TRACE("pb", display(tout, *c); tout << " := " << lit << " " << is_true << "\n";);        
@@ -107,8 +107,10 @@ struct mus::imp {
                 if (!core_exprs.contains(not_lit)) {
                     // unknown := core_exprs \ mus
                     unknown.reset();
+                    expr_set in_mus;
+                    for (expr* e : mus) in_mus.insert(e);
                     for (expr* c : core_exprs) {
-                        if (!mus.contains(c)) {
+                        if (!in_mus.contains(c)) {
                             unknown.push_back(c);
                         }
                     }
@@ -33,6 +33,7 @@ Notes:
 #include <cmath>
 #include <condition_variable>
 #include "util/scoped_ptr_vector.h"
+#include "util/stopwatch.h"
 #include "ast/ast_util.h"
 #include "ast/ast_translation.h"
 #include "solver/solver.h"
@@ -54,6 +55,7 @@ class parallel_tactic : public tactic {
         ptr_vector<solver_state>     m_active;
         unsigned                     m_num_waiters;
         volatile bool                m_shutdown;
+        double                       m_idle_time;
 
         void inc_wait() {
             std::lock_guard<std::mutex> lock(m_mutex);
@@ -80,7 +82,8 @@ class parallel_tactic : public tactic {
 
         task_queue(): 
             m_num_waiters(0), 
-            m_shutdown(false) {}             
+            m_shutdown(false),
+            m_idle_time(0) {}             
 
         ~task_queue() { reset(); }
 
@@ -97,6 +100,16 @@ class parallel_tactic : public tactic {
 
         bool in_shutdown() const { return m_shutdown; }
 
+        /**
+           \brief total time workers spent waiting for a task, summed over threads.
+        */
+        double idle_time() const { return m_idle_time; }
+
+        void reset_idle_time() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idle_time = 0;
+        }
+
         void add_task(solver_state* task) {
             std::lock_guard<std::mutex> lock(m_mutex);
             m_tasks.push_back(task);
@@ -119,8 +132,12 @@ class parallel_tactic : public tactic {
                     return st;
                 }
                 {
+                    stopwatch sw;
+                    sw.start();
                     std::unique_lock<std::mutex> lock(m_mutex);
                     m_cond.wait(lock);
+                    sw.stop();
+                    m_idle_time += sw.get_seconds();
                 }
                 dec_wait();
             }
@@ -331,6 +348,7 @@ private:
     bool          m_allsat;
     unsigned      m_num_unsat;
     unsigned      m_last_depth;
+    double        m_busy_time;
     int           m_exn_code;
     std::string   m_exn_msg;
 
@@ -343,6 +361,8 @@ private:
         m_branches = 0;    
         m_num_unsat = 0;
         m_last_depth = 0;
+        m_busy_time = 0;
+        m_queue.reset_idle_time();
         m_backtrack_frequency = pp.conquer_backtrack_frequency();
         m_conquer_delay = pp.conquer_delay();
         m_exn_code = 0;
@@ -603,8 +623,11 @@ private:
     void run_solver() {
         try {
             while (solver_state* st = m_queue.get_task()) {
+                stopwatch sw;
+                sw.start();
                 cube_and_conquer(*st);
-                collect_statistics(*st);
+                sw.stop();
+                collect_statistics(*st, sw.get_seconds());
                 m_queue.task_done(st);
                 if (st->m().canceled()) m_queue.shutdown();
                 IF_VERBOSE(1, display(verbose_stream()););
@@ -626,8 +649,10 @@ private:
         }
     }
 
-    void collect_statistics(solver_state& s) {
-        collect_statistics(s.get_solver());
+    void collect_statistics(solver_state& s, double busy_time) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_busy_time += busy_time;
+        s.get_solver().collect_statistics(m_stats);
     }
 
     void collect_statistics(solver& s) {
@@ -748,10 +773,14 @@ public:
         st.update("par unsat", m_num_unsat);
         st.update("par models", m_models.size());
         st.update("par progress", m_progress);
+        st.update("par busy time", m_busy_time);
+        st.update("par idle time", m_queue.idle_time());
     }
 
     void reset_statistics() override {
         m_stats.reset();
+        m_busy_time = 0;
+        m_queue.reset_idle_time();
     }
 };
 
@@ -362,6 +362,7 @@ void solver_pool::collect_statistics(statistics &st) const {
     st.update("pool_solver.checks", m_stats.m_num_checks);
     st.update("pool_solver.checks.sat", m_stats.m_num_sat_checks);
     st.update("pool_solver.checks.undef", m_stats.m_num_undef_checks);
+    st.update("pool_solver.refreshes", m_stats.m_num_refreshes);
 }
 
 void solver_pool::reset_statistics() {
@@ -412,6 +413,7 @@ void solver_pool::reset_solver(solver* s) {
 void solver_pool::refresh(solver* base_solver) {
     ast_manager& m = m_base_solver->get_manager();
     ref<solver> new_base = m_base_solver->translate(m, m_base_solver->get_params());
+    m_stats.m_num_refreshes++;
     for (solver* s0 : m_solvers) {
         pool_solver* s = dynamic_cast<pool_solver*>(s0);
         if (base_solver == s->base_solver()) {
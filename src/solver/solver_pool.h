@@ -38,6 +38,7 @@ class solver_pool {
         unsigned m_num_checks;
         unsigned m_num_sat_checks;
         unsigned m_num_undef_checks;
+        unsigned m_num_refreshes;
         stats() { reset(); }
         void reset() { memset(this, 0, sizeof(*this)); }
     };
@@ -589,7 +589,10 @@ struct ctx_simplify_tactic::imp {
         else {
             process_goal(g);
         }
-        IF_VERBOSE(TACTIC_VERBOSITY_LVL, verbose_stream() << "(ctx-simplify :num-steps " << m_num_steps << ")\n";);
+        // when the step budget is exhausted the remaining subterms are left as is,
+        // the goal keeps the partial simplification.
+        IF_VERBOSE(TACTIC_VERBOSITY_LVL, verbose_stream() << "(ctx-simplify :num-steps " << m_num_steps
+                   << (m_num_steps >= m_max_steps ? " :budget-exhausted" : "") << ")\n";);
         SASSERT(g.is_well_sorted());
     }
 
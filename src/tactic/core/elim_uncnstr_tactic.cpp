@@ -816,7 +816,7 @@ class elim_uncnstr_tactic : public tactic {
             // did not increase depth since it didn't do anything.
             return;
         }
-        bool modified = true;
+        bool modified = false;
         TRACE("elim_uncnstr", tout << "unconstrained variables...\n";
                 for (expr * v : m_vars) tout << mk_ismt2_pp(v, m()) << " "; 
                 tout << "\n";);
@@ -16,11 +16,15 @@ Author:
 Notes:
 
 --*/
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include "util/scoped_timer.h"
 #include "util/cancel_eh.h"
 #include "util/cooperate.h"
 #include "util/scoped_ptr_vector.h"
-#include "util/z3_omp.h"
+#include "util/stopwatch.h"
 #include "tactic/tactical.h"
 
 class binary_tactical : public tactic {
@@ -367,6 +371,67 @@ enum par_exception_kind {
     ERROR_EX
 };
 
+/**
+   \brief Task scheduler shared by the parallel combinators.
+
+   The calling thread and up to num_tasks - 1 additional threads pull
+   task indices from a shared counter until all tasks are consumed.
+   Additional threads are drawn from a process-wide budget bounded by
+   the number of hardware threads, so nested par/par_and_then combinators
+   still obtain parallelism while cores are available, and otherwise
+   degrade to running their tasks on the calling thread instead of
+   oversubscribing the machine.
+*/
+class par_scheduler {
+    static std::atomic<unsigned> s_num_extra_threads;
+    unsigned                     m_num_extra;
+    std::atomic<unsigned>        m_next;
+
+    static unsigned max_threads() {
+        unsigned n = std::thread::hardware_concurrency();
+        return n == 0 ? 1 : n;
+    }
+
+public:
+    par_scheduler(unsigned num_tasks): m_num_extra(0), m_next(0) {
+        unsigned limit  = max_threads() - 1;
+        unsigned wanted = num_tasks > 0 ? num_tasks - 1 : 0;
+        unsigned curr   = s_num_extra_threads.load();
+        unsigned num_extra;
+        do {
+            num_extra = curr >= limit ? 0 : std::min(limit - curr, wanted);
+        }
+        while (num_extra > 0 && !s_num_extra_threads.compare_exchange_weak(curr, curr + num_extra));
+        m_num_extra = num_extra;
+    }
+
+    ~par_scheduler() {
+        s_num_extra_threads -= m_num_extra;
+    }
+
+    unsigned num_threads() const { return m_num_extra + 1; }
+
+    static bool has_free_threads() { return s_num_extra_threads.load() + 1 < max_threads(); }
+
+    template<typename F>
+    void operator()(unsigned num_tasks, F const& f) {
+        auto worker = [&]() {
+            unsigned i;
+            while ((i = m_next++) < num_tasks) {
+                f(i);
+            }
+        };
+        vector<std::thread> threads;
+        for (unsigned i = 0; i < m_num_extra; ++i)
+            threads.push_back(std::thread(worker));
+        worker();
+        for (std::thread& t : threads)
+            t.join();
+    }
+};
+
+std::atomic<unsigned> par_scheduler::s_num_extra_threads(0);
+
 class par_tactical : public or_else_tactical {
 
 
@@ -377,14 +442,10 @@ public:
     
 
     void operator()(goal_ref const & in, goal_ref_buffer& result) override {
-        bool use_seq;
-#ifdef _NO_OMP_
-        use_seq = true;
-#else
-        use_seq = 0 != omp_in_parallel();
-#endif
-        if (use_seq) {
-            // execute tasks sequentially
+        unsigned sz = m_ts.size();
+        par_scheduler sched(sz);
+        if (sched.num_threads() == 1) {
+            // no threads available, execute tasks sequentially
             or_else_tactical::operator()(in, result);
             return;
         }
@@ -395,7 +456,6 @@ public:
         scoped_limits scl(m.limit());
         goal_ref_vector                in_copies;
         tactic_ref_vector              ts;
-        unsigned sz = m_ts.size();
         for (unsigned i = 0; i < sz; i++) {
             ast_manager * new_m = alloc(ast_manager, m, !m.proof_mode());
             managers.push_back(new_m);
@@ -409,9 +469,9 @@ public:
         par_exception_kind ex_kind = DEFAULT_EX;
         std::string        ex_msg;
         unsigned           error_code = 0;
+        std::mutex         mux;
         
-        #pragma omp parallel for
-        for (int i = 0; i < static_cast<int>(sz); i++) {
+        sched(sz, [&](unsigned i) {
             goal_ref_buffer     _result;
             
             goal_ref in_copy = in_copies[i];
@@ -420,8 +480,8 @@ public:
             try {
                 t(in_copy, _result);
                 bool first = false;
-                #pragma omp critical (par_tactical)
                 {
+                    std::lock_guard<std::mutex> lock(mux);
                     if (finished_id == UINT_MAX) {
                         finished_id = i;
                         first = true;
@@ -429,7 +489,7 @@ public:
                 }                
                 if (first) {
                     for (unsigned j = 0; j < sz; j++) {
-                        if (static_cast<unsigned>(i) != j) {
+                        if (i != j) {
                             managers[j]->limit().cancel();
                         }
                     }
@@ -459,7 +519,7 @@ public:
                     ex_msg = z3_ex.msg();
                 }
             }
-        }
+        });
         if (finished_id == UINT_MAX) {
             switch (ex_kind) {
             case ERROR_EX: throw z3_error(error_code);
@@ -498,14 +558,8 @@ public:
     ~par_and_then_tactical() override {}
 
     void operator()(goal_ref const & in, goal_ref_buffer& result) override {
-        bool use_seq;
-#ifdef _NO_OMP_
-        use_seq = true;
-#else
-        use_seq = 0 != omp_in_parallel();
-#endif
-        if (use_seq) {
-            // execute tasks sequentially
+        if (!par_scheduler::has_free_threads()) {
+            // no threads available, execute tasks sequentially
             and_then_tactical::operator()(in, result);
             return;
         }
@@ -530,6 +584,7 @@ public:
             m_t2->operator()(r1_0, result);
         }                                                                                     
         else {                                                                                              
+            par_scheduler sched(r1_size);
 
             scoped_ptr_vector<ast_manager> managers;
             tactic_ref_vector              ts2;
@@ -555,8 +610,9 @@ public:
             unsigned error_code = 0;
             std::string  ex_msg;
 
-            #pragma omp parallel for
-            for (int i = 0; i < static_cast<int>(r1_size); i++) { 
+            std::mutex         mux;
+
+            sched(r1_size, [&](unsigned i) {
                 ast_manager & new_m = *(managers[i]);
                 goal_ref new_g = g_copies[i];
 
@@ -568,42 +624,36 @@ public:
                     ts2[i]->operator()(new_g, r2);                  
                 }
                 catch (tactic_exception & ex) {
-                    #pragma omp critical (par_and_then_tactical)
-                    {
-                        if (!failed && !found_solution) {
-                            curr_failed = true;
-                            failed      = true;
-                            ex_kind     = TACTIC_EX;
-                            ex_msg      = ex.msg();
-                        }
+                    std::lock_guard<std::mutex> lock(mux);
+                    if (!failed && !found_solution) {
+                        curr_failed = true;
+                        failed      = true;
+                        ex_kind     = TACTIC_EX;
+                        ex_msg      = ex.msg();
                     }
                 }
                 catch (z3_error & err) {
-                    #pragma omp critical (par_and_then_tactical)
-                    {
-                        if (!failed && !found_solution) {
-                            curr_failed = true;
-                            failed      = true;
-                            ex_kind     = ERROR_EX;
-                            error_code  = err.error_code();
-                        }
-                    }                    
+                    std::lock_guard<std::mutex> lock(mux);
+                    if (!failed && !found_solution) {
+                        curr_failed = true;
+                        failed      = true;
+                        ex_kind     = ERROR_EX;
+                        error_code  = err.error_code();
+                    }
                 }
                 catch (z3_exception & z3_ex) {
-                    #pragma omp critical (par_and_then_tactical)
-                    {
-                        if (!failed && !found_solution) {
-                            curr_failed = true;
-                            failed      = true;
-                            ex_kind     = DEFAULT_EX;
-                            ex_msg      = z3_ex.msg();
-                        }
+                    std::lock_guard<std::mutex> lock(mux);
+                    if (!failed && !found_solution) {
+                        curr_failed = true;
+                        failed      = true;
+                        ex_kind     = DEFAULT_EX;
+                        ex_msg      = z3_ex.msg();
                     }
                 }
 
                 if (curr_failed) {
                     for (unsigned j = 0; j < r1_size; j++) {
-                        if (static_cast<unsigned>(i) != j) {
+                        if (i != j) {
                             managers[j]->limit().cancel();
                         }
                     }
@@ -614,8 +664,8 @@ public:
                         if (is_decided_sat(r2)) {                                                          
                             // found solution... 
                             bool first = false;
-                            #pragma omp critical (par_and_then_tactical)
                             {
+                                std::lock_guard<std::mutex> lock(mux);
                                 if (!found_solution) {
                                     failed         = false;
                                     found_solution = true;
@@ -624,7 +674,7 @@ public:
                             }
                             if (first) {
                                 for (unsigned j = 0; j < r1_size; j++) {
-                                    if (static_cast<unsigned>(i) != j) {
+                                    if (i != j) {
                                         managers[j]->limit().cancel();
                                     }
                                 }
@@ -655,7 +705,7 @@ public:
                         }
                     }                                                                                           
                 }
-            }
+            });
             
             if (failed) {
                 switch (ex_kind) {
@@ -994,6 +1044,57 @@ tactic * annotate_tactic(char const* name, tactic * t) {
     return alloc(annotate_tactical, name, t);
 }
 
+class profile_tactical : public unary_tactical {
+    std::string m_name;
+
+    static unsigned num_exprs(goal_ref_buffer const& gs) {
+        unsigned r = 0;
+        for (goal* g : gs) r += g->num_exprs();
+        return r;
+    }
+
+public:
+    profile_tactical(char const* name, tactic* t):
+        unary_tactical(t), m_name(name) {}
+
+    void operator()(goal_ref const & in, goal_ref_buffer& result) override {
+        unsigned depth    = in->depth();
+        unsigned size     = in->size();
+        unsigned exprs    = in->num_exprs();
+        long long memory  = static_cast<long long>(memory::get_allocation_size());
+        stopwatch sw;
+        sw.start();
+        try {
+            m_t->operator()(in, result);
+        }
+        catch (...) {
+            sw.stop();
+            IF_VERBOSE(0, verbose_stream() << "(profile " << m_name << " :depth " << depth 
+                       << " :time " << sw.get_seconds() << " :failed)\n";);
+            throw;
+        }
+        sw.stop();
+        unsigned out_size = 0;
+        for (goal* g : result) out_size += g->size();
+        IF_VERBOSE(0, verbose_stream() << "(profile " << m_name 
+                   << " :depth " << depth
+                   << " :time " << sw.get_seconds()
+                   << " :memory-delta " << (static_cast<long long>(memory::get_allocation_size()) - memory)
+                   << " :goals " << result.size()
+                   << " :size " << size << " -> " << out_size
+                   << " :num-exprs " << exprs << " -> " << num_exprs(result) << ")\n";);
+    }
+
+    tactic * translate(ast_manager & m) override { 
+        tactic * new_t = m_t->translate(m);
+        return alloc(profile_tactical, m_name.c_str(), new_t);
+    }
+};
+
+tactic * profile_tactic(char const* name, tactic * t) {
+    return alloc(profile_tactical, name, t);
+}
+
 class cond_tactical : public binary_tactical {
     probe_ref m_p;
 public:
@@ -64,6 +64,8 @@ tactic * try_for(tactic * t, unsigned msecs);
 tactic * clean(tactic * t);
 tactic * using_params(tactic * t, params_ref const & p);
 tactic * annotate_tactic(char const* name, tactic * t);
+// Report running time, allocation delta and goal sizes of t on the verbose stream.
+tactic * profile_tactic(char const* name, tactic * t);
 
 // Create a tactic that fails if the result returned by probe p is true.
 tactic * fail_if(probe * p);
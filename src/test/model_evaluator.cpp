@@ -5,8 +5,40 @@
 #include "ast/reg_decl_plugins.h"
 #include "ast/ast_pp.h"
 
+static void tst_func_interp_entries() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    func_interp fi(m, 1);
+    expr_ref_vector nums(m);
+    for (unsigned i = 0; i < 100; ++i) 
+        nums.push_back(a.mk_int(i));
+    for (unsigned i = 0; i < 100; ++i) {
+        expr* arg = nums.get(i);
+        fi.insert_entry(&arg, nums.get((2*i) % 100));
+    }
+    for (unsigned i = 0; i < 100; ++i) {
+        expr* arg = nums.get(i);
+        func_entry * e = fi.get_entry(&arg);
+        ENSURE(e && e->get_result() == nums.get((2*i) % 100));
+    }
+    expr_ref other(a.mk_int(100), m);
+    expr* arg = other.get();
+    ENSURE(fi.get_entry(&arg) == nullptr);
+    fi.insert_entry(&arg, nums.get(0));
+    ENSURE(fi.get_entry(&arg) && fi.num_entries() == 101);
+    arg = nums.get(3);
+    fi.insert_entry(&arg, nums.get(0));
+    ENSURE(fi.get_entry(&arg)->get_result() == nums.get(0) && fi.num_entries() == 101);
+    fi.set_else(nums.get(0));
+    fi.compress();
+    ENSURE(fi.get_entry(&arg) == nullptr);
+    arg = nums.get(4);
+    ENSURE(fi.get_entry(&arg) && fi.get_entry(&arg)->get_result() == nums.get(8));
+}
 
 void tst_model_evaluator() {
+    tst_func_interp_entries();
     ast_manager m;
     reg_decl_plugins(m);
     arith_util a(m);
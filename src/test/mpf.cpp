@@ -18,6 +18,8 @@ Revision History:
 --*/
 #include "util/mpf.h"
 #include "util/f2n.h"
+#include <cmath>
+#include <limits>
 
 static void bug_set_int() {
     mpf_manager fm;
@@ -81,8 +83,65 @@ static void bug_set_double() {
     ENSURE(fm.to_float(a) == -42.25);
 }
 
+// The binary64 and binary32 operations under round-nearest-even must agree with
+// rounding the exact rational result, and with IEEE 754 on zeros, infinities and NaN.
+template<typename T>
+static void tst_hw_ops(unsigned ebits, unsigned sbits, int min_exp, int max_exp) {
+    mpf_manager fm;
+    unsynch_mpq_manager & qm = fm.mpq_manager();
+    scoped_mpf a(fm), b(fm), r(fm), expected(fm);
+    scoped_mpq qa(qm), qb(qm), qr(qm);
+    random_gen rand(17);
+    T inf = std::numeric_limits<T>::infinity();
+    T mx  = std::numeric_limits<T>::max();
+    T mn  = std::numeric_limits<T>::min();
+    T dn  = std::numeric_limits<T>::denorm_min();
+    vector<T> vals;
+    T specials[] = { static_cast<T>(0.0), -static_cast<T>(0.0), inf, -inf, std::numeric_limits<T>::quiet_NaN(),
+                     mx, -mx, mn, -mn, dn, -dn, mn / 4, -mn / 3, static_cast<T>(1.0), static_cast<T>(-1.0),
+                     static_cast<T>(-1.5) };
+    for (T v : specials) 
+        vals.push_back(v);
+    for (unsigned i = 0; i < 60; ++i) {
+        T m = static_cast<T>(rand(1 << 20) + 1) / (1 << 20);
+        int e = min_exp + static_cast<int>(rand(max_exp - min_exp));
+        vals.push_back((rand(2) ? -1 : 1) * std::ldexp(m, e));
+    }
+    for (T x : vals) {
+        for (T y : vals) {
+            fm.set(a, ebits, sbits, x);
+            fm.set(b, ebits, sbits, y);
+            bool finite = std::isfinite(x) && std::isfinite(y); 
+            if (finite) {
+                fm.to_rational(a, qm, qa);
+                fm.to_rational(b, qm, qb);
+            }
+            for (unsigned op = 0; op < 4; ++op) {
+                T hw;
+                switch (op) {
+                case 0: fm.add(MPF_ROUND_NEAREST_TEVEN, a, b, r); hw = x + y; if (finite) qm.add(qa, qb, qr); break;
+                case 1: fm.sub(MPF_ROUND_NEAREST_TEVEN, a, b, r); hw = x - y; if (finite) qm.sub(qa, qb, qr); break;
+                case 2: fm.mul(MPF_ROUND_NEAREST_TEVEN, a, b, r); hw = x * y; if (finite) qm.mul(qa, qb, qr); break;
+                default: fm.div(MPF_ROUND_NEAREST_TEVEN, a, b, r); hw = x / y; if (finite && y != 0) qm.div(qa, qb, qr); break;
+                }
+                if (std::isnan(hw)) {
+                    ENSURE(fm.is_nan(r));
+                    continue;
+                }
+                if (finite && !(op == 3 && y == 0) && !qm.is_zero(qr)) 
+                    fm.set(expected, ebits, sbits, MPF_ROUND_NEAREST_TEVEN, qr);
+                else 
+                    fm.set(expected, ebits, sbits, hw);
+                ENSURE(fm.eq(r, expected) && fm.sgn(r) == fm.sgn(expected));
+            }
+        }
+    }
+}
+
 void tst_mpf() {
     enable_trace("mpf_mul_bug");
     bug_set_int();
     bug_set_double();
+    tst_hw_ops<double>(11, 53, -1080, 1030);
+    tst_hw_ops<float>(8, 24, -155, 135);
 }
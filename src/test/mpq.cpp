@@ -159,7 +159,40 @@ static void tst_prev_power_2() {
     tst_prev_power_2((1ll << 60), 3, 58);
 }
 
+// a + b and a - b are normalized and equal to the cross-multiplied sum,
+// in particular for integral operands and equal denominators.
+static void tst_lin_arith() {
+    unsynch_mpq_manager m;
+    scoped_mpq a(m), b(m), c(m);
+    scoped_mpz an(m), ad(m), bn(m), bd(m), cn(m), cd(m), t1(m), t2(m), g(m);
+    int dens[4] = { 1, 6, 6, 35 };
+    for (int i = -7; i <= 7; i++) {
+        for (int j = -7; j <= 7; j++) {
+            for (unsigned k = 0; k < 16; k++) {
+                m.set(a, i, dens[k % 4]);
+                m.set(b, j, dens[k / 4]);
+                for (unsigned sub = 0; sub < 2; sub++) {
+                    if (sub) m.sub(a, b, c); else m.add(a, b, c);
+                    m.get_numerator(a, an); m.get_denominator(a, ad);
+                    m.get_numerator(b, bn); m.get_denominator(b, bd);
+                    m.get_numerator(c, cn); m.get_denominator(c, cd);
+                    m.gcd(cn, cd, g);
+                    ENSURE(m.is_one(g));
+                    m.mul(an, bd, t1);
+                    m.mul(bn, ad, t2);
+                    if (sub) m.sub(t1, t2, t1); else m.add(t1, t2, t1);
+                    m.mul(t1, cd, t1);
+                    m.mul(ad, bd, t2);
+                    m.mul(t2, cn, t2);
+                    ENSURE(m.eq(t1, t2));
+                }
+            }
+        }
+    }
+}
+
 void tst_mpq() {
+    tst_lin_arith();
     tst_prev_power_2();
     set_str_bug();
     bug2();
@@ -490,8 +490,32 @@ static void tst_pw2() {
     }
 }
 
+static void mk_random_mpz(unsynch_mpz_manager & m, unsigned num_digits, mpz & r) {
+    m.set(r, 1);
+    for (unsigned i = 0; i < num_digits; i++) {
+        m.mul2k(r, 32);
+        m.add(r, mpz(rand()), r);
+    }
+}
+
+// products above the Karatsuba threshold must agree with division.
+static void tst_karatsuba() {
+    unsynch_mpz_manager m;
+    scoped_mpz a(m), b(m), c(m), q(m), r(m);
+    for (unsigned i = 0; i < 100; i++) {
+        mk_random_mpz(m, 10 + rand() % 150, a);
+        mk_random_mpz(m, 10 + rand() % 150, b);
+        m.mul(a, b, c);
+        m.div(c, b, q);
+        m.rem(c, b, r);
+        ENSURE(m.eq(q, a));
+        ENSURE(m.is_zero(r));
+    }
+}
+
 void tst_mpz() {
     disable_trace("mpz");
+    tst_karatsuba();
     enable_trace("mpz_2k");
     tst_pw2();
     tst5();
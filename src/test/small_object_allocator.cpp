@@ -9,7 +9,25 @@ Copyright (c) 2015 Microsoft Corporation
 #include "util/trace.h"
 #include "util/small_object_allocator.h"
 
+#include "util/vector.h"
+
+// Chunks whose objects are all free are released, including the partially
+// used chunk and size classes that do not divide the chunk size.
+static void tst_consolidate(size_t size, unsigned n) {
+    small_object_allocator soa;
+    ptr_vector<char> objs;
+    for (unsigned i = 0; i < n; ++i)
+        objs.push_back(static_cast<char*>(soa.allocate(size)));
+    for (char * p : objs)
+        soa.deallocate(size, p);
+    soa.consolidate();
+    ENSURE(soa.get_num_free_objs() == 0);
+}
+
 void tst_small_object_allocator() {
+    tst_consolidate(16, 3000);
+    tst_consolidate(56, 10);
+    tst_consolidate(24, 1000);
     small_object_allocator soa;
 
     char * p1 = new (soa) char[13];
@@ -6,6 +6,43 @@ Copyright (c) 2015 Microsoft Corporation
 
 #include "smt/smt_context.h"
 #include "ast/reg_decl_plugins.h"
+#include "ast/bv_decl_plugin.h"
+
+// bvmul problems must have the same answer whether multipliers are blasted eagerly or lazily.
+static lbool check_bv_mul(bool delay, bool sat) {
+    smt_params params;
+    params.m_bv_delay = delay;
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    smt::context ctx(m, params);
+    unsigned sz = 16;
+    sort_ref s(bv.mk_sort(sz), m);
+    app_ref x(m.mk_const(symbol("x"), s), m);
+    app_ref y(m.mk_const(symbol("y"), s), m);
+    app_ref xy(bv.mk_bv_mul(x, y), m);
+    if (sat) {
+        // x * y = 143 with non-trivial factors
+        ctx.assert_expr(m.mk_eq(xy, bv.mk_numeral(143, sz)));
+        ctx.assert_expr(m.mk_not(bv.mk_ule(x, bv.mk_numeral(1, sz))));
+        ctx.assert_expr(m.mk_not(bv.mk_ule(y, bv.mk_numeral(1, sz))));
+        ctx.assert_expr(bv.mk_ule(x, bv.mk_numeral(142, sz)));
+        ctx.assert_expr(bv.mk_ule(y, bv.mk_numeral(142, sz)));
+    }
+    else {
+        // an odd product needs an odd factor
+        ctx.assert_expr(m.mk_eq(xy, bv.mk_numeral(1, sz)));
+        ctx.assert_expr(m.mk_eq(bv.mk_extract(0, 0, x), bv.mk_numeral(0, 1)));
+    }
+    return ctx.check();
+}
+
+static void tst_bv_delay() {
+    ENSURE(check_bv_mul(false, true) == l_true);
+    ENSURE(check_bv_mul(true, true) == l_true);
+    ENSURE(check_bv_mul(false, false) == l_false);
+    ENSURE(check_bv_mul(true, false) == l_false);
+}
 
 void tst_smt_context()
 {
@@ -32,4 +69,6 @@ void tst_smt_context()
     }
 
     ctx.check();
+
+    tst_bv_delay();
 }
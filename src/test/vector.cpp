@@ -17,6 +17,7 @@ Revision History:
 
 --*/
 #include "util/vector.h"
+#include "util/memory_manager.h"
 
 static void tst1() {
     svector<int> v1;
@@ -56,6 +57,32 @@ static void tst1() {
     }
 }
 
+static void tst2() {
+    // growing past the memory limit must leave the vector usable
+    svector<unsigned> v;
+    for (unsigned i = 0; i < 1000; i++)
+        v.push_back(i);
+    memory::set_max_size(static_cast<size_t>(memory::get_allocation_size()) + (64 << 20));
+    bool caught = false;
+    try {
+        for (unsigned i = 1000; i < (1u << 30); i++)
+            v.push_back(i);
+    }
+    catch (out_of_memory_error&) {
+        caught = true;
+    }
+    memory::set_max_size(0);
+    ENSURE(caught);
+    for (unsigned i = 0; i < v.size(); i++)
+        ENSURE(v[i] == i);
+    unsigned sz = v.size();
+    v.push_back(sz);
+    ENSURE(v.back() == sz);
+    v.reset();
+    v.finalize();
+}
+
 void tst_vector() {
     tst1();
+    tst2();
 }
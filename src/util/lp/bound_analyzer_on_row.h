@@ -113,6 +113,24 @@ public :
     }
 
 
+    // Rows coming from difference constraints have mostly unit coefficients:
+    // avoid the rational multiplication and division for them.
+    static mpq mul_coeff(const mpq & a, const mpq & v) {
+        if (a.is_one())
+            return v;
+        if (a.is_minus_one())
+            return -v;
+        return a * v;
+    }
+
+    static mpq div_coeff(const mpq & v, const mpq & a) {
+        if (a.is_one())
+            return v;
+        if (a.is_minus_one())
+            return -v;
+        return v / a;
+    }
+
     const mpq & monoid_max_no_mult(bool a_is_pos, unsigned j, bool & strict) const {
         if (a_is_pos) {
             strict = !is_zero(ub(j).y);
@@ -123,17 +141,17 @@ public :
     }
     mpq monoid_max(const mpq & a, unsigned j) const {
         if (is_pos(a)) {
-            return a * ub(j).x;
+            return mul_coeff(a, ub(j).x);
         }
-        return a * lb(j).x;
+        return mul_coeff(a, lb(j).x);
     }
     mpq monoid_max(const mpq & a, unsigned j, bool & strict) const {
         if (is_pos(a)) {
             strict = !is_zero(ub(j).y);
-            return a * ub(j).x;
+            return mul_coeff(a, ub(j).x);
         }
         strict = !is_zero(lb(j).y);
-        return a * lb(j).x;
+        return mul_coeff(a, lb(j).x);
     }
     const mpq & monoid_min_no_mult(bool a_is_pos, unsigned j, bool & strict) const {
         if (!a_is_pos) {
@@ -147,19 +165,19 @@ public :
     mpq monoid_min(const mpq & a, unsigned j, bool& strict) const {
         if (is_neg(a)) {
             strict = !is_zero(ub(j).y);
-            return a * ub(j).x;
+            return mul_coeff(a, ub(j).x);
         }
         
         strict = !is_zero(lb(j).y);
-        return a * lb(j).x;
+        return mul_coeff(a, lb(j).x);
     }
 
     mpq monoid_min(const mpq & a, unsigned j) const {
         if (is_neg(a)) {
-            return a * ub(j).x;
+            return mul_coeff(a, ub(j).x);
         }
         
-        return a * lb(j).x;
+        return mul_coeff(a, lb(j).x);
     }
     
 
@@ -178,7 +196,7 @@ public :
         for (const auto &p : m_row) {
             bool str;
             bool a_is_pos = is_pos(p.coeff());
-            mpq bound = total / p.coeff() + monoid_min_no_mult(a_is_pos, p.var(), str);
+            mpq bound = div_coeff(total, p.coeff()) + monoid_min_no_mult(a_is_pos, p.var(), str);
             if (a_is_pos) {
                 limit_j(p.var(), bound, true, false, strict - static_cast<int>(str) > 0);
             }
@@ -202,7 +220,7 @@ public :
         for (const auto& p : m_row) {
             bool str;
             bool a_is_pos = is_pos(p.coeff());
-            mpq bound = total / p.coeff() + monoid_max_no_mult(a_is_pos, p.var(), str);
+            mpq bound = div_coeff(total, p.coeff()) + monoid_max_no_mult(a_is_pos, p.var(), str);
             bool astrict = strict - static_cast<int>(str) > 0; 
             if (a_is_pos) {
                 limit_j(p.var(), bound, true, true, astrict);
@@ -233,7 +251,7 @@ public :
                 strict = true;
         }
 
-        bound /= u_coeff;
+        bound = div_coeff(bound, u_coeff);
         
         if (numeric_traits<impq>::is_pos(u_coeff)) {
             limit_j(m_column_of_u, bound, true, true, strict);
@@ -262,7 +280,7 @@ public :
             if (str)
                 strict = true;
         }
-        bound /= l_coeff;
+        bound = div_coeff(bound, l_coeff);
         if (is_pos(l_coeff)) {
             limit_j(m_column_of_l, bound, true, false, strict);
         } else {
@@ -166,12 +166,12 @@ namespace nra {
             auto sz = lhs.size();
             svector<polynomial::var> vars;
             rational den = denominator(rhs);
-            for (auto kv : lhs) {
+            for (auto const& kv : lhs) {
                 vars.push_back(lp2nl(kv.second));
                 den = lcm(den, denominator(kv.first));
             }
             vector<rational> coeffs;
-            for (auto kv : lhs) {
+            for (auto const& kv : lhs) {
                 coeffs.push_back(den * kv.first);
             }
             rhs *= den;
@@ -228,7 +228,7 @@ namespace nra {
         }
 
         std::ostream& display(std::ostream& out) const {
-            for (auto m : m_monomials) {
+            for (auto const& m : m_monomials) {
                 out << "v" << m.m_v << " = ";
                 for (auto v : m.m_vs) {
                     out << "v" << v << " ";
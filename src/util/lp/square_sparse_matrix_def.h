@@ -879,7 +879,7 @@ unsigned square_sparse_matrix<T, X>::pivot_score(unsigned i, unsigned j) {
     // which gives rnz(cnz-1). For example, is 0 for a column singleton, but not for
     // a row singleton ( which is not a column singleton).
 
-    auto col_header = m_columns[j];
+    auto const & col_header = m_columns[j];
 
     return static_cast<unsigned>(get_row_values(i).size() * (col_header.m_values.size() - col_header.m_shortened_markovitz - 1));
 }
@@ -890,7 +890,7 @@ void square_sparse_matrix<T, X>::enqueue_domain_into_pivot_queue() {
     for (unsigned i = 0; i < dimension(); i++) {
         auto & rh = m_rows[i];
         unsigned rnz = static_cast<unsigned>(rh.size());
-        for (auto iv : rh) {
+        for (auto const & iv : rh) {
             unsigned j = iv.m_index;
             m_pivot_queue.enqueue(i, j, rnz * (static_cast<unsigned>(m_columns[j].m_values.size()) - 1));
         }
@@ -12,6 +12,18 @@ Copyright (c) 2015 Microsoft Corporation
 #include "util/error_codes.h"
 #include "util/z3_omp.h"
 #include "util/debug.h"
+#if defined(__GLIBC__) || defined(__APPLE__)
+// The C library (or an allocator such as jemalloc/mimalloc that replaces it)
+// can report the size of a block. In this case the thread local allocation
+// functions below don't store an extra size field in front of each block.
+# define HAS_MALLOC_USABLE_SIZE
+# ifdef __APPLE__
+#  include <malloc/malloc.h>
+#  define malloc_usable_size malloc_size
+# else
+#  include <malloc.h>
+# endif
+#endif
 // The following two function are automatically generated by the mk_make.py script.
 // The script collects ADD_INITIALIZER and ADD_FINALIZER commands in the .h files.
 // For example, rational.h contains
@@ -278,6 +290,51 @@ static void synchronize_counters(bool allocating) {
     }
 }
 
+#ifdef HAS_MALLOC_USABLE_SIZE
+
+void memory::deallocate(void * p) {
+    g_memory_thread_alloc_size -= malloc_usable_size(p);
+    free(p);
+    if (g_memory_thread_alloc_size < -SYNCH_THRESHOLD) {
+        synchronize_counters(false);
+    }
+}
+
+void * memory::allocate(size_t s) {
+    void * r = malloc(s);
+    if (r == nullptr) {
+        throw_out_of_memory();
+        return nullptr;
+    }
+    g_memory_thread_alloc_size += malloc_usable_size(r);
+    g_memory_thread_alloc_count += 1;
+    if (g_memory_thread_alloc_size > SYNCH_THRESHOLD) {
+        synchronize_counters(true);
+    }
+    return r;
+}
+
+void* memory::reallocate(void *p, size_t s) {
+    size_t sz = malloc_usable_size(p);
+    // account for the growth before realloc releases p, so that an
+    // out_of_memory exception leaves the caller's block intact.
+    g_memory_thread_alloc_size += static_cast<long long>(s) - static_cast<long long>(sz);
+    g_memory_thread_alloc_count += 1;
+    if (g_memory_thread_alloc_size > SYNCH_THRESHOLD) {
+        synchronize_counters(true);
+    }
+
+    void *r = realloc(p, s);
+    if (r == nullptr) {
+        throw_out_of_memory();
+        return nullptr;
+    }
+    g_memory_thread_alloc_size += static_cast<long long>(malloc_usable_size(r)) - static_cast<long long>(s);
+    return r;
+}
+
+#else
+
 void memory::deallocate(void * p) {
     size_t * sz_p  = reinterpret_cast<size_t*>(p) - 1;
     size_t sz      = *sz_p;
@@ -327,6 +384,8 @@ void* memory::reallocate(void *p, size_t s) {
     return static_cast<size_t*>(r) + 1; // we return a pointer to the location after the extra field
 }
 
+#endif
+
 #else
 // ==================================
 // ==================================
@@ -18,8 +18,17 @@ Revision History:
 --*/
 #include<sstream>
 #include<iomanip>
+#include<cfenv>
+#include<cfloat>
+#include<cmath>
 #include "util/mpf.h"
 
+// hwf_manager changes the rounding mode through SSE intrinsics on Windows,
+// which fegetround does not necessarily observe.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0 && !defined(_WINDOWS)
+#define MPF_USE_HW
+#endif
+
 mpf::mpf() :
     ebits(0),
     sbits(0),
@@ -467,6 +476,48 @@ bool mpf_manager::gte(mpf const & x, mpf const & y) {
     return gt(x, y) || eq(x, y);
 }
 
+/**
+   \brief Return true if an operation of rounding mode rm on binary64 (resp. binary32) operands
+   x and y can be evaluated with hardware doubles (resp. floats). IEEE 754 requires the basic operations
+   to be correctly rounded, so the result matches the software implementation bit for bit,
+   provided the hardware rounds to nearest-even and does not evaluate with excess precision.
+   Flush-to-zero and denormals-are-zero modes are not visible through fegetround, so only
+   normal operands are handled here, and set_hw rejects zero and subnormal results.
+*/
+bool mpf_manager::use_hw_double(mpf_rounding_mode rm, mpf const & x, mpf const & y) {
+#ifdef MPF_USE_HW
+    return rm == MPF_ROUND_NEAREST_TEVEN && x.ebits == 11 && x.sbits == 53 && 
+        is_normal(x) && is_normal(y) && fegetround() == FE_TONEAREST;
+#else
+    return false;
+#endif
+}
+
+bool mpf_manager::use_hw_float(mpf_rounding_mode rm, mpf const & x, mpf const & y) {
+#ifdef MPF_USE_HW
+    return rm == MPF_ROUND_NEAREST_TEVEN && x.ebits == 8 && x.sbits == 24 && 
+        is_normal(x) && is_normal(y) && fegetround() == FE_TONEAREST;
+#else
+    return false;
+#endif
+}
+
+bool mpf_manager::set_hw(mpf & o, unsigned ebits, unsigned sbits, double value) {
+    int c = std::fpclassify(value);
+    if (c != FP_NORMAL && c != FP_INFINITE)
+        return false;
+    set(o, ebits, sbits, value);
+    return true;
+}
+
+bool mpf_manager::set_hw(mpf & o, unsigned ebits, unsigned sbits, float value) {
+    int c = std::fpclassify(value);
+    if (c != FP_NORMAL && c != FP_INFINITE)
+        return false;
+    set(o, ebits, sbits, value);
+    return true;
+}
+
 void mpf_manager::add(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
     add_sub(rm, x, y, o, false);
 }
@@ -478,6 +529,17 @@ void mpf_manager::sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf &
 void mpf_manager::add_sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o, bool sub) {
     SASSERT(x.sbits == y.sbits && x.ebits == y.ebits);
 
+    if (use_hw_double(rm, x, y)) {
+        double a = to_double(x), b = to_double(y);
+        if (set_hw(o, x.ebits, x.sbits, sub ? a - b : a + b))
+            return;
+    }
+    if (use_hw_float(rm, x, y)) {
+        float a = to_float(x), b = to_float(y);
+        if (set_hw(o, x.ebits, x.sbits, sub ? a - b : a + b))
+            return;
+    }
+
     bool sgn_y = sgn(y) ^ sub;
 
     if (is_nan(x))
@@ -592,6 +654,11 @@ void mpf_manager::mul(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf &
           tout << "Y: " << to_string(y) << "\n";);
     SASSERT(x.sbits == y.sbits && x.ebits == y.ebits);
 
+    if (use_hw_double(rm, x, y) && set_hw(o, x.ebits, x.sbits, to_double(x) * to_double(y)))
+        return;
+    if (use_hw_float(rm, x, y) && set_hw(o, x.ebits, x.sbits, to_float(x) * to_float(y)))
+        return;
+
     TRACE("mpf_dbg", tout << "X = " << to_string(x) << std::endl;);
     TRACE("mpf_dbg", tout << "Y = " << to_string(y) << std::endl;);
 
@@ -667,6 +734,11 @@ void mpf_manager::mul(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf &
 void mpf_manager::div(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o) {
     SASSERT(x.sbits == y.sbits && x.ebits == y.ebits);
 
+    if (use_hw_double(rm, x, y) && set_hw(o, x.ebits, x.sbits, to_double(x) / to_double(y)))
+        return;
+    if (use_hw_float(rm, x, y) && set_hw(o, x.ebits, x.sbits, to_float(x) / to_float(y)))
+        return;
+
     TRACE("mpf_dbg", tout << "X = " << to_string(x) << std::endl;);
     TRACE("mpf_dbg", tout << "Y = " << to_string(y) << std::endl;);
 
@@ -225,6 +225,10 @@ protected:
 
     void unpack(mpf & o, bool normalize);
     void add_sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf & o, bool sub);
+    bool use_hw_double(mpf_rounding_mode rm, mpf const & x, mpf const & y);
+    bool use_hw_float(mpf_rounding_mode rm, mpf const & x, mpf const & y);
+    bool set_hw(mpf & o, unsigned ebits, unsigned sbits, double value);
+    bool set_hw(mpf & o, unsigned ebits, unsigned sbits, float value);
     void round(mpf_rounding_mode rm, mpf & o);
     void round_sqrt(mpf_rounding_mode rm, mpf & o);
 
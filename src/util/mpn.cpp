@@ -104,18 +104,98 @@ bool mpn_manager::sub(mpn_digit const * a, size_t const lnga,
     return true; // return k != 0?
 }
 
+#define DIGIT_BITS (sizeof(mpn_digit)*8)
+#define HALF_BITS (sizeof(mpn_digit)*4)
+
+// Operands with fewer digits use the quadratic algorithm.
+#define KARATSUBA_THRESHOLD 32
+
+// c[0..lngc) += a[0..lnga), lngc >= lnga; returns the carry out of c.
+static mpn_digit add_to(mpn_digit * c, size_t lngc, mpn_digit const * a, size_t lnga) {
+    mpn_digit k = 0;
+    size_t j = 0;
+    for (; j < lnga; j++) {
+        mpn_double_digit t = (mpn_double_digit)c[j] + (mpn_double_digit)a[j] + (mpn_double_digit)k;
+        c[j] = (mpn_digit)t;
+        k = (mpn_digit)(t >> DIGIT_BITS);
+    }
+    for (; k != 0 && j < lngc; j++) {
+        c[j] += k;
+        k = c[j] == 0;
+    }
+    return k;
+}
+
+// c[0..lngc) -= a[0..lnga), requires c >= a.
+static void sub_from(mpn_digit * c, size_t lngc, mpn_digit const * a, size_t lnga) {
+    mpn_digit k = 0;
+    size_t j = 0;
+    for (; j < lnga; j++) {
+        mpn_digit r = c[j] - a[j];
+        bool c1 = r > c[j];
+        c[j] = r - k;
+        k = c1 | (c[j] > r);
+    }
+    for (; k != 0 && j < lngc; j++) {
+        k = c[j] == 0;
+        c[j]--;
+    }
+    SASSERT(k == 0);
+}
+
+/**
+   \brief Karatsuba multiplication for lnga >= lngb >= KARATSUBA_THRESHOLD.
+   With a = a1*B^h + a0 and b = b1*B^h + b0,
+   a*b = a1*b1*B^2h + ((a0+a1)*(b0+b1) - a0*b0 - a1*b1)*B^h + a0*b0.
+*/
+void mpn_manager::mul_karatsuba(mpn_digit const * a, size_t lnga,
+                                mpn_digit const * b, size_t lngb,
+                                mpn_digit * c) const {
+    SASSERT(lnga >= lngb && lngb >= KARATSUBA_THRESHOLD);
+    size_t h = lngb / 2;
+    size_t lnga1 = lnga - h, lngb1 = lngb - h;
+    // c = a1*b1*B^2h + a0*b0
+    mul(a, h, b, h, c);
+    mul(a + h, lnga1, b + h, lngb1, c + 2*h);
+    // sa = a0 + a1, sb = b0 + b1
+    mpn_sbuffer sa(lnga1 + 1, 0), sb(lngb1 + 1, 0);
+    for (size_t i = 0; i < lnga1; i++) sa[i] = a[h + i];
+    for (size_t i = 0; i < lngb1; i++) sb[i] = b[h + i];
+    sa[lnga1] = add_to(sa.c_ptr(), lnga1, a, h);
+    sb[lngb1] = add_to(sb.c_ptr(), lngb1, b, h);
+    // z1 = sa*sb - a0*b0 - a1*b1
+    size_t lngz = lnga1 + lngb1 + 2;
+    mpn_sbuffer z(lngz, 0);
+    mul(sa.c_ptr(), lnga1 + 1, sb.c_ptr(), lngb1 + 1, z.c_ptr());
+    sub_from(z.c_ptr(), lngz, c, 2*h);
+    sub_from(z.c_ptr(), lngz, c + 2*h, lnga1 + lngb1);
+    // the high digits of z are zero, as z1 < B^(lnga+lngb-h)
+    size_t lngc = lnga + lngb;
+    while (lngz > lngc - h) {
+        SASSERT(z[lngz - 1] == 0);
+        lngz--;
+    }
+    VERIFY(add_to(c + h, lngc - h, z.c_ptr(), lngz) == 0);
+}
+
 bool mpn_manager::mul(mpn_digit const * a, size_t const lnga,
                       mpn_digit const * b, size_t const lngb,
                       mpn_digit * c) const {
     trace(a, lnga, b, lngb, "*");
+    if (lnga >= lngb && lngb >= KARATSUBA_THRESHOLD) {
+        mul_karatsuba(a, lnga, b, lngb, c);
+        trace_nl(c, lnga+lngb);
+        return true;
+    }
+    if (lngb > lnga && lnga >= KARATSUBA_THRESHOLD) {
+        mul_karatsuba(b, lngb, a, lnga, c);
+        trace_nl(c, lnga+lngb);
+        return true;
+    }
     // Essentially Knuth's Algorithm M. 
-    // Perhaps implement a more efficient version, see e.g., Knuth, Section 4.3.3.    
     size_t i;
     mpn_digit k;
 
-#define DIGIT_BITS (sizeof(mpn_digit)*8)
-#define HALF_BITS (sizeof(mpn_digit)*4)
-
     for (unsigned i = 0; i < lnga; i++)
         c[i] = 0;
 
@@ -95,6 +95,10 @@ private:
                          mpn_sbuffer & n_numer,
                          mpn_sbuffer & n_denom) const;
 
+    void mul_karatsuba(mpn_digit const * a, size_t lnga,
+                       mpn_digit const * b, size_t lngb,
+                       mpn_digit * c) const;
+
     void div_unnormalize(mpn_sbuffer & numer, mpn_sbuffer & denom,
                          size_t d, mpn_digit * rem) const;
 
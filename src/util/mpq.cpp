@@ -323,6 +323,32 @@ unsigned mpq_manager<SYNCH>::prev_power_of_two(mpq const & a) {
 template<bool SYNCH>
 template<bool SUB>
 void mpq_manager<SYNCH>::lin_arith_op(mpq const& a, mpq const& b, mpq& c, mpz& g, mpz& tmp1, mpz& tmp2, mpz& tmp3) {
+    // gcd(n + k*d, d) = gcd(n, d) = 1: no normalization needed when one side is integral.
+    if (is_one(b.m_den)) {
+        mul(b.m_num, a.m_den, tmp1);
+        if (SUB) sub(a.m_num, tmp1, c.m_num); else add(a.m_num, tmp1, c.m_num);
+        set(c.m_den, a.m_den);
+        return;
+    }
+    if (is_one(a.m_den)) {
+        mul(a.m_num, b.m_den, tmp1);
+        if (SUB) sub(tmp1, b.m_num, c.m_num); else add(tmp1, b.m_num, c.m_num);
+        set(c.m_den, b.m_den);
+        return;
+    }
+    if (eq(a.m_den, b.m_den)) {
+        if (SUB) sub(a.m_num, b.m_num, tmp3); else add(a.m_num, b.m_num, tmp3);
+        gcd(tmp3, a.m_den, g);
+        if (is_one(g)) {
+            set(c.m_num, tmp3);
+            set(c.m_den, a.m_den);
+        }
+        else {
+            div(tmp3, g, c.m_num);
+            div(a.m_den, g, c.m_den);
+        }
+        return;
+    }
     gcd(a.m_den, b.m_den, g);                   
     if (is_one(g)) {                            
        mul(a.m_num, b.m_den, tmp1);             
@@ -242,30 +242,6 @@ void mpz_manager<SYNCH>::del(mpz & a) {
     } 
 }
 
-template<bool SYNCH>
-void mpz_manager<SYNCH>::add(mpz const & a, mpz const & b, mpz & c) {
-    STRACE("mpz", tout << "[mpz] " << to_string(a) << " + " << to_string(b) << " == ";); 
-    if (is_small(a) && is_small(b)) {
-        set_i64(c, i64(a) + i64(b));
-    }
-    else {
-        big_add(a, b, c);
-    }
-    STRACE("mpz", tout << to_string(c) << "\n";);
-}
-
-template<bool SYNCH>
-void mpz_manager<SYNCH>::sub(mpz const & a, mpz const & b, mpz & c) {
-    STRACE("mpz", tout << "[mpz] " << to_string(a) << " - " << to_string(b) << " == ";); 
-    if (is_small(a) && is_small(b)) {
-        set_i64(c, i64(a) - i64(b));
-    }
-    else {
-        big_sub(a, b, c);
-    }
-    STRACE("mpz", tout << to_string(c) << "\n";);
-}
-
 template<bool SYNCH>
 void mpz_manager<SYNCH>::set_big_i64(mpz & c, int64_t v) {
 #ifndef _MP_GMP
@@ -489,18 +465,6 @@ void mpz_manager<SYNCH>::set_digits(mpz & target, unsigned sz, digit_t const * d
     }
 }
 
-template<bool SYNCH>
-void mpz_manager<SYNCH>::mul(mpz const & a, mpz const & b, mpz & c) {
-    STRACE("mpz", tout << "[mpz] " << to_string(a) << " * " << to_string(b) << " == ";); 
-    if (is_small(a) && is_small(b)) {
-        set_i64(c, i64(a) * i64(b));
-    }
-    else {
-        big_mul(a, b, c);
-    }
-    STRACE("mpz", tout << to_string(c) << "\n";);
-}
-
 // d <- a + b*c
 template<bool SYNCH>
 void mpz_manager<SYNCH>::addmul(mpz const & a, mpz const & b, mpz const & c, mpz & d) {
@@ -383,15 +383,39 @@ public:
     
     void del(mpz & a);
     
-    void add(mpz const & a, mpz const & b, mpz & c);
+    // add, sub and mul are inlined so that the common case of small operands
+    // does not pay for a call; large operands are handled in mpz.cpp.
 
-    void sub(mpz const & a, mpz const & b, mpz & c);
+    void add(mpz const & a, mpz const & b, mpz & c) {
+        STRACE("mpz", tout << "[mpz] " << to_string(a) << " + " << to_string(b) << " == ";); 
+        if (is_small(a) && is_small(b))
+            set_i64(c, i64(a) + i64(b));
+        else
+            big_add(a, b, c);
+        STRACE("mpz", tout << to_string(c) << "\n";);
+    }
+
+    void sub(mpz const & a, mpz const & b, mpz & c) {
+        STRACE("mpz", tout << "[mpz] " << to_string(a) << " - " << to_string(b) << " == ";); 
+        if (is_small(a) && is_small(b))
+            set_i64(c, i64(a) - i64(b));
+        else
+            big_sub(a, b, c);
+        STRACE("mpz", tout << to_string(c) << "\n";);
+    }
     
     void inc(mpz & a) { add(a, mpz(1), a); }
 
     void dec(mpz & a) { add(a, mpz(-1), a); }
 
-    void mul(mpz const & a, mpz const & b, mpz & c);
+    void mul(mpz const & a, mpz const & b, mpz & c) {
+        STRACE("mpz", tout << "[mpz] " << to_string(a) << " * " << to_string(b) << " == ";); 
+        if (is_small(a) && is_small(b))
+            set_i64(c, i64(a) * i64(b));
+        else
+            big_mul(a, b, c);
+        STRACE("mpz", tout << to_string(c) << "\n";);
+    }
 
     // d <- a + b*c
     void addmul(mpz const & a, mpz const & b, mpz const & c, mpz & d);
@@ -181,9 +181,14 @@ void small_object_allocator::consolidate() {
             continue;
         chunks.reset();
         free_objs.reset();
+        unsigned obj_size = slot_id << PTR_ALIGNMENT;
+        // A chunk holds only the objects carved out of it so far: the most recent
+        // chunk is partially used, and allocate never fills a chunk up to its end.
+        unsigned min_objs_per_chunk = UINT_MAX;
         chunk * c = m_chunks[slot_id];
         while (c != nullptr) {
             chunks.push_back(c);
+            min_objs_per_chunk = std::min(min_objs_per_chunk, static_cast<unsigned>((c->m_curr - c->m_data) / obj_size));
             c = c->m_next;
         }
         char * ptr = static_cast<char*>(m_free_list[slot_id]);
@@ -191,9 +196,7 @@ void small_object_allocator::consolidate() {
             free_objs.push_back(ptr);
             ptr = *(reinterpret_cast<char**>(ptr));
         }
-        unsigned obj_size = slot_id << PTR_ALIGNMENT;
-        unsigned num_objs_per_chunk = CHUNK_SIZE / obj_size;
-        if (free_objs.size() < num_objs_per_chunk)
+        if (free_objs.size() < min_objs_per_chunk)
             continue;
         SASSERT(!chunks.empty());
         std::sort(chunks.begin(), chunks.end(), ptr_lt<chunk>());
@@ -207,17 +210,18 @@ void small_object_allocator::consolidate() {
         while (chunk_idx < num_chunks) {
             chunk * curr_chunk = chunks[chunk_idx];
             char *  curr_begin = curr_chunk->m_data;
-            char *  curr_end   = curr_begin + CHUNK_SIZE;
+            char *  curr_end   = curr_chunk->m_curr;
+            unsigned num_objs_in_chunk = static_cast<unsigned>((curr_end - curr_begin) / obj_size);
             unsigned num_free_in_chunk = 0;
             unsigned saved_obj_idx = obj_idx;
             while (obj_idx < num_objs) {
                 char * free_obj = free_objs[obj_idx];
-                if (free_obj > curr_end)
+                if (free_obj >= curr_end)
                     break;
                 obj_idx++;
                 num_free_in_chunk++;
             }
-            if (num_free_in_chunk == num_objs_per_chunk) {
+            if (num_free_in_chunk == num_objs_in_chunk) {
                 dealloc(curr_chunk);
             }
             else {